@@ -36,6 +36,7 @@ namespace Editor
 		if (mTargetActor)
 		{
 			mTargetActor->Update(dt);
+			mTargetActor->UpdateComponents(dt);
 			mTargetActor->UpdateChildren(dt);
 		}
 
@@ -18,6 +18,7 @@
 #include "o2/Scene/UI/Widgets/MenuPanel.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Editor/EditorScope.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
 #include "o2/Utils/Tasks/TaskManager.h"
@@ -177,6 +178,10 @@ namespace Editor
 		Application::ProcessFrame();
 
 		mDrawCalls = mRender->GetDrawCallsCount();
+		mSavedDrawCalls = mRender->GetSortingSavedDrawCallsCount();
+
+		mFrameAllocations = mFrameAllocator->GetAllocationsCount();
+		mFrameAllocatedBytes = (int)mFrameAllocator->GetAllocatedBytes();
 	}
 
 	void EditorApplication::CheckPlayingSwitch()
@@ -263,6 +268,8 @@ namespace Editor
 		Application::PostUpdateEventSystem();
 	}
 
+#undef DrawText
+
 	void EditorApplication::OnUpdate(float dt)
 	{
 		mWindowsManager->Update(dt);
@@ -274,14 +281,17 @@ namespace Editor
 		o2Application.windowCaption = String("o2 Editor: ") + mLoadedScene + 
 			"; FPS: " + (String)((int)o2Time.GetFPS()) +
 			" DC: " + (String)mDrawCalls +
+			" (saved " + (String)mSavedDrawCalls + ")" +
 			" Cursor: " + (String)o2Input.GetCursorPos();
 
+		Vec2F resolution = o2Render.GetResolution();
+		o2Debug.DrawText(Vec2F(-resolution.x*0.5f, -resolution.y*0.5f + 20.0f), "Frame allocs: " + (String)mFrameAllocations +
+						 " (" + (String)(mFrameAllocatedBytes/1024) + " KB)");
+
 		if (o2Input.IsKeyPressed('K'))
 			o2Memory.DumpInfo();
 	}
 
-#undef DrawText
-
 	void EditorApplication::OnDraw()
 	{
 		PushEditorScopeOnStack scope;
@@ -88,7 +88,11 @@ namespace Editor
 		bool mPlayingChanged = false; // True when need to update playing mode on update
 		bool mUpdateStep = false;     // True when frame updating available on this frame
 
-		int mDrawCalls; // Draw calls count, stored before beginning rendering
+		int mDrawCalls;      // Draw calls count, stored before beginning rendering
+		int mSavedDrawCalls; // Draw calls count saved by draws sorting, stored before beginning rendering
+
+		int mFrameAllocations;    // Frame allocator allocations count on last frame
+		int mFrameAllocatedBytes; // Frame allocator allocated bytes on last frame
 
 	protected:
 		// Check style rebuilding and loads editor UI style
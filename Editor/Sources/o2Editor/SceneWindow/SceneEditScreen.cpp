@@ -198,8 +198,7 @@ namespace Editor
 				if (!layer->visible)
 					continue;
 
-				for (auto drw : layer->GetEnabledDrawables())
-					drw->Draw();
+				layer->Draw();
 			}
 
 			o2Scene.EndDrawingScene();
@@ -17,8 +17,10 @@
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 #include "o2/Utils/Tasks/TaskManager.h"
 
 namespace o2
@@ -71,10 +73,19 @@ namespace o2
 		mPhysics->PostUpdate();
 	}
 
+	void Application::InterpolatePhysics(float alpha)
+	{
+		mPhysics->Interpolate(alpha);
+	}
+
 	void Application::InitalizeSystems()
 	{
 		srand((UInt)time(NULL));
 
+		mFrameAllocator = mnew FrameAllocator();
+
+		mJobSystem = mnew JobSystem();
+
 		mTime = mnew Time();
 
 		mLog = mnew LogStream("Application");
@@ -115,6 +126,8 @@ namespace o2
 		delete mAssets;
 		delete mEventSystem;
 		delete mTaskManager;
+		delete mJobSystem;
+		delete mFrameAllocator;
 	}
 
 	void Application::ProcessFrame()
@@ -122,6 +135,8 @@ namespace o2
 		if (!mReady)
 			return;
 
+		mFrameAllocator->Reset();
+
 		if (mCursorInfiniteModeEnabled)
 			CheckCursorInfiniteMode();
 
@@ -142,6 +157,7 @@ namespace o2
 		mTime->Update(realdDt);
 		o2Debug.Update(dt);
 		mTaskManager->Update(dt);
+		mAssets->UpdateLoading();
 		UpdateEventSystem();
 
 		mRender->Begin();
@@ -163,6 +179,8 @@ namespace o2
 			mAccumulatedDT -= fixedDT;
 		}
 
+		InterpolatePhysics(mAccumulatedDT/fixedDT);
+
 		PostUpdateEventSystem();
 
 		OnDraw();
@@ -267,6 +285,11 @@ namespace o2
 		return mInstance->mTime;
 	}
 
+	FrameAllocator& Application::GetFrameAllocator() const
+	{
+		return *mInstance->mFrameAllocator;
+	}
+
 	MemoryManager* MemoryManager::mInstance = new MemoryManager();
 	template<> Debug* Singleton<Debug>::mInstance = mnew Debug();
 	template<> FileSystem* Singleton<FileSystem>::mInstance = mnew FileSystem();
@@ -22,7 +22,9 @@ namespace o2
 	class Assets;
 	class EventSystem;
 	class FileSystem;
+	class FrameAllocator;
 	class Input;
+	class JobSystem;
 	class LogStream;
 	class PhysicsWorld;
 	class ProjectConfig;
@@ -78,6 +80,9 @@ namespace o2
 		// Returns pointer to time utilities object
 		virtual Time* GetTime() const;
 
+		// Returns per-frame arena for transient allocations. Memory is valid until the beginning of next frame
+		FrameAllocator& GetFrameAllocator() const;
+
 		// Shutting down application
 		virtual void Shutdown();
 
@@ -172,19 +177,21 @@ namespace o2
 	protected:
 		bool mReady = false; // Is all systems is ready
 
-		Assets*        mAssets = nullptr;        // Assets
-		EventSystem*   mEventSystem = nullptr;   // Events processing system
-		FileSystem*    mFileSystem = nullptr;    // File system
-		Input*         mInput = nullptr;         // While application user input message
-		LogStream*     mLog = nullptr;           // Log stream with id "app", using only for application messages
-		PhysicsWorld*  mPhysics = nullptr;       // Physics
-		ProjectConfig* mProjectConfig = nullptr; // Project config
-		Render*        mRender = nullptr;        // Graphics render
-		Scene*         mScene = nullptr;         // Scene
-		TaskManager*   mTaskManager = nullptr;   // Tasks manager
-		Time*          mTime = nullptr;          // Time utilities
-		Timer*         mTimer = nullptr;         // Timer for detecting delta time for update
-		UIManager*     mUIManager = nullptr;     // UI manager
+		Assets*         mAssets = nullptr;         // Assets
+		EventSystem*    mEventSystem = nullptr;    // Events processing system
+		FileSystem*     mFileSystem = nullptr;     // File system
+		FrameAllocator* mFrameAllocator = nullptr; // Per-frame transient allocations arena, reset at frame beginning
+		Input*          mInput = nullptr;          // While application user input message
+		JobSystem*      mJobSystem = nullptr;      // Work-stealing jobs system for parallel updating
+		LogStream*      mLog = nullptr;            // Log stream with id "app", using only for application messages
+		PhysicsWorld*   mPhysics = nullptr;        // Physics
+		ProjectConfig*  mProjectConfig = nullptr;  // Project config
+		Render*         mRender = nullptr;         // Graphics render
+		Scene*          mScene = nullptr;          // Scene
+		TaskManager*    mTaskManager = nullptr;    // Tasks manager
+		Time*           mTime = nullptr;           // Time utilities
+		Timer*          mTimer = nullptr;          // Timer for detecting delta time for update
+		UIManager*      mUIManager = nullptr;      // UI manager
 
 		bool  mCursorInfiniteModeEnabled = false; // Is cursor infinite mode enabled
 		Vec2F mCursorCorrectionDelta;             // Cursor corrections delta - result of infinite cursors offset
@@ -213,6 +220,9 @@ namespace o2
 		// After update physics
 		virtual void PostUpdatePhysics();
 
+		// Interpolates physics bodies transforms between fixed steps. Alpha is part of fixed step, remaining in accumulated time
+		virtual void InterpolatePhysics(float alpha);
+
 		// Draws scene
 		virtual void DrawScene();
 
@@ -116,6 +116,12 @@ namespace o2
 	}
 
 	void Asset::Load(const AssetInfo& info)
+	{
+		SetInfo(info);
+		LoadData(GetBuiltFullPath());
+	}
+
+	void Asset::SetInfo(const AssetInfo& info)
 	{
 		auto oldPath = mInfo.path;
 		auto oldUID = mInfo.meta->mId;
@@ -123,8 +129,6 @@ namespace o2
 		mInfo = info;
 
 		o2Assets.UpdateAssetCache(this, oldPath, oldUID);
-
-		LoadData(GetBuiltFullPath());
 	}
 
 	void Asset::Save(const String& path, bool rebuildAssetsImmediately /*= true*/)
@@ -201,6 +205,16 @@ namespace o2
 		Deserialize(data);
 	}
 
+	void Asset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{
+		preload.data.LoadFromFile(path);
+	}
+
+	void Asset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{
+		Deserialize(preload.data);
+	}
+
 	void Asset::SaveData(const String& path) const
 	{
 		DataDocument data;
@@ -211,6 +225,12 @@ namespace o2
 	void Asset::OnUIDChanged(const UID& oldUID)
 	{}
 
+	AssetPreloadData::~AssetPreloadData()
+	{
+		if (rawData)
+			delete[] rawData;
+	}
+
 }
 
 DECLARE_CLASS(o2::Asset);
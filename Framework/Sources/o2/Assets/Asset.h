@@ -11,6 +11,27 @@
 
 namespace o2
 {
+	// --------------------------------------------------------------------------------------------------
+	// Asset data, read on loading thread in asynchronous loading. It is applied to asset on main thread
+	// --------------------------------------------------------------------------------------------------
+	struct AssetPreloadData
+	{
+		struct TextureSource
+		{
+			String fileName;         // Texture file name. Empty for atlas page, it is resolved on main thread
+			UID    atlasAssetId = 0; // Atlas asset id, 0 when texture isn't atlas page
+			int    atlasPage = -1;   // Atlas page index
+		};
+
+		DataDocument          data;              // Parsed asset data
+		char*                 rawData = nullptr; // Raw file data for not serialized assets
+		UInt                  rawDataSize = 0;   // Raw file data size
+		Vector<TextureSource> textures;          // Textures, required by asset. They are decoded on loading thread
+
+		// Destructor, releases raw data
+		~AssetPreloadData();
+	};
+
 	// -------------------------------------------------------------------------------------------------
 	// Basic asset interface. Contains copy of asset, without caching. For regular use assets references
 	// -------------------------------------------------------------------------------------------------
@@ -130,9 +151,18 @@ namespace o2
 		// Loads asset from path
 		void Load(const AssetInfo& info);
 
+		// Sets asset info and updates assets cache, doesn't load data
+		void SetInfo(const AssetInfo& info);
+
 		// Loads asset data, using DataValue and serialization
 		virtual void LoadData(const String& path);
 
+		// Reads and parses asset data on loading thread. Must not use engine systems and change asset
+		virtual void PreloadData(const String& path, AssetPreloadData& preload) const;
+
+		// Loads asset data from preloaded on main thread
+		virtual void LoadPreloadedData(const String& path, AssetPreloadData& preload);
+
 		// Saves asset data, using DataValue and serialization
 		virtual void SaveData(const String& path) const;
 
@@ -142,6 +172,7 @@ namespace o2
 		friend class AssetRef;
 		friend class Assets;
 		friend class AssetsBuilder;
+		friend class AssetsLoader;
 	};
 
 	// This macro defines asset type
@@ -216,7 +247,10 @@ CLASS_METHODS_META(o2::Asset)
 	PROTECTED_FUNCTION(LogStream*, GetAssetsLogStream);
 	PROTECTED_FUNCTION(void, SetMeta, AssetMeta*);
 	PROTECTED_FUNCTION(void, Load, const AssetInfo&);
+	PROTECTED_FUNCTION(void, SetInfo, const AssetInfo&);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, PreloadData, const String&, AssetPreloadData&);
+	PROTECTED_FUNCTION(void, LoadPreloadedData, const String&, AssetPreloadData&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
 	PROTECTED_FUNCTION(void, OnUIDChanged, const UID&);
 }
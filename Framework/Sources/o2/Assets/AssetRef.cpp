@@ -168,6 +168,17 @@ namespace o2
 		return mAssetPtr != nullptr;
 	}
 
+	bool AssetRef::IsLoading() const
+	{
+		return mAssetPtr && o2Assets.mAssetsLoader->IsLoading(mAssetPtr);
+	}
+
+	void AssetRef::CompleteLoading()
+	{
+		if (mAssetPtr)
+			o2Assets.mAssetsLoader->Complete(mAssetPtr);
+	}
+
 	Asset* AssetRef::Get()
 	{
 		return mAssetPtr;
@@ -60,6 +60,12 @@ namespace o2
 		// Returns is reference is valid
 		bool IsValid() const;
 
+		// Returns true when asset is loading asynchronously. Reference is valid, but asset data isn't loaded yet
+		bool IsLoading() const;
+
+		// Finishes asynchronous asset loading immediately
+		void CompleteLoading();
+
 		// Returns asset
 		Asset* Get();
 
@@ -250,6 +256,8 @@ CLASS_METHODS_META(o2::AssetRef)
 {
 
 	PUBLIC_FUNCTION(bool, IsValid);
+	PUBLIC_FUNCTION(bool, IsLoading);
+	PUBLIC_FUNCTION(void, CompleteLoading);
 	PUBLIC_FUNCTION(Asset*, Get);
 	PUBLIC_FUNCTION(const Asset*, Get);
 	PUBLIC_FUNCTION(const Type&, GetAssetType);
@@ -2,6 +2,7 @@
 #include "Assets.h"
 
 #include "o2/Assets/Asset.h"
+#include "o2/Assets/AssetsLoader.h"
 #include "o2/Assets/Types/BinaryAsset.h"
 #include "o2/Assets/Types/FolderAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
@@ -21,6 +22,7 @@ namespace o2
 		o2Debug.GetLog()->BindStream(mLog);
 
 		mAssetsBuilder = mnew AssetsBuilder();
+		mAssetsLoader = mnew AssetsLoader();
 
 		LoadAssetTypes();
 
@@ -32,6 +34,7 @@ namespace o2
 
 	Assets::~Assets()
 	{
+		delete mAssetsLoader;
 		delete mAssetsBuilder;
 	}
 
@@ -112,6 +115,8 @@ namespace o2
 
 			cached = FindAssetCache(asset->GetUID());
 		}
+		else
+			mAssetsLoader->Complete(cached->asset);
 
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
@@ -134,10 +139,92 @@ namespace o2
 
 			cached = FindAssetCache(id);
 		}
+		else
+			mAssetsLoader->Complete(cached->asset);
 
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
 
+	AssetRef Assets::LoadAsync(const String& path, int priority /*= 0*/, 
+							   const Function<void(const AssetRef&)>& onLoaded /*= Function<void(const AssetRef&)>()*/)
+	{
+		auto& assetInfo = GetAssetInfo(path);
+		if (!assetInfo.IsValid())
+		{
+			mLog->Error("Can't load asset by path (" + path + "): asset isn't exist");
+			return AssetRef();
+		}
+
+		return LoadAsync(assetInfo, priority, onLoaded);
+	}
+
+	AssetRef Assets::LoadAsync(const UID& id, int priority /*= 0*/,
+							   const Function<void(const AssetRef&)>& onLoaded /*= Function<void(const AssetRef&)>()*/)
+	{
+		auto& assetInfo = GetAssetInfo(id);
+		if (!assetInfo.IsValid())
+		{
+			mLog->Error("Can't load asset by id (" + (String)id + "): asset isn't exist");
+			return AssetRef();
+		}
+
+		return LoadAsync(assetInfo, priority, onLoaded);
+	}
+
+	AssetRef Assets::LoadAsync(const AssetInfo& info, int priority, const Function<void(const AssetRef&)>& onLoaded)
+	{
+		Function<void(Asset*)> onAssetLoaded;
+		if (!onLoaded.IsEmpty())
+		{
+			onAssetLoaded = [this, onLoaded](Asset* asset) {
+				if (auto cached = FindAssetCache(asset->GetUID()))
+					onLoaded(AssetRef(cached->asset, &cached->referencesCount));
+			};
+		}
+
+		auto cached = FindAssetCache(info.meta->ID());
+		if (!cached)
+		{
+			Asset* asset = (Asset*)info.meta->GetAssetType()->CreateSample();
+			asset->SetInfo(info);
+
+			cached = FindAssetCache(asset->GetUID());
+			mAssetsLoader->Load(asset, priority, onAssetLoaded);
+
+			return AssetRef(cached->asset, &cached->referencesCount);
+		}
+
+		AssetRef res(cached->asset, &cached->referencesCount);
+
+		if (mAssetsLoader->IsLoading(cached->asset))
+			mAssetsLoader->Load(cached->asset, priority, onAssetLoaded);
+		else if (!onLoaded.IsEmpty())
+			onLoaded(res);
+
+		return res;
+	}
+
+	void Assets::SetLoadingPriority(const AssetRef& asset, int priority)
+	{
+		if (asset)
+			mAssetsLoader->SetPriority(asset.Get(), priority);
+	}
+
+	int Assets::GetLoadingAssetsCount() const
+	{
+		return mAssetsLoader->GetLoadingAssetsCount();
+	}
+
+	void Assets::SetLoadingFrameTimeBudget(float seconds)
+	{
+		mAssetsLoader->SetFrameTimeBudget(seconds);
+	}
+
+	void Assets::UpdateLoading()
+	{
+		mAssetsLoader->Update();
+	}
+
 	bool Assets::IsAssetExist(const String& path) const
 	{
 		return GetAssetInfo(path).meta->ID() != UID::empty;
@@ -331,6 +418,9 @@ namespace o2
 
 	void Assets::RebuildAssets(bool forcible /*= false*/)
 	{
+		// Loading threads are reading assets trees
+		mAssetsLoader->CompleteAll();
+
 		auto oldAssetsTrees = mAssetsTrees;
 		mAssetsTrees.Clear();
 
@@ -483,7 +573,10 @@ namespace o2
 		for (auto cached : cachedAssets)
 		{
 			if (cached->referencesCount <= 0)
+			{
+				mAssetsLoader->Cancel(cached->asset);
 				delete cached->asset;
+			}
 		}
 	}
 
@@ -544,6 +637,8 @@ namespace o2
 
 	void Assets::RemoveAssetCache(Asset* asset)
 	{
+		mAssetsLoader->Cancel(asset);
+
 		AssetCache* cached = nullptr;
 		auto fnd = mCachedAssetsByUID.find(asset->GetUID());
 		if (fnd != mCachedAssetsByUID.end()) {
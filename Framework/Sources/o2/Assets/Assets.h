@@ -16,6 +16,7 @@
 namespace o2
 {
 	class AssetsBuilder;
+	class AssetsLoader;
 	class LogStream;
 
 	// ----------------
@@ -70,6 +71,28 @@ namespace o2
 		// Returns asset reference by id
 		AssetRef GetAssetRef(const UID& id);
 
+		// Starts asynchronous asset loading by path. Returns pending reference immediately, asset data is read in 
+		// background and applied on main thread. Loading is canceled when all references are released before it's done.
+		// Callback is called when asset is loaded, immediately when asset is already loaded
+		AssetRef LoadAsync(const String& path, int priority = 0, 
+						   const Function<void(const AssetRef&)>& onLoaded = Function<void(const AssetRef&)>());
+
+		// Starts asynchronous asset loading by id. Returns pending reference immediately
+		AssetRef LoadAsync(const UID& id, int priority = 0,
+						   const Function<void(const AssetRef&)>& onLoaded = Function<void(const AssetRef&)>());
+
+		// Sets asynchronous loading priority of asset. Assets with greater priority are loaded first
+		void SetLoadingPriority(const AssetRef& asset, int priority);
+
+		// Returns count of assets loading asynchronously
+		int GetLoadingAssetsCount() const;
+
+		// Sets main thread time budget in seconds per frame for finishing asynchronously loaded assets and uploading textures
+		void SetLoadingFrameTimeBudget(float seconds);
+
+		// Finishes asynchronously loaded assets and uploads textures within frame time budget. Called by application each frame
+		void UpdateLoading();
+
 		// Creates asset type _asset_type
 		template<typename _asset_type, typename ... _args>
 		AssetRef CreateAsset(_args ... args);
@@ -148,6 +171,7 @@ namespace o2
 		Vector<AssetsTree*> mAssetsTrees;    // Assets trees
 		LogStream*          mLog;            // Log stream
 		AssetsBuilder*      mAssetsBuilder;  // Assets builder
+		AssetsLoader*       mAssetsLoader;   // Asynchronous assets loader
 
 		Map<String, const Type*> mAssetsTypes;   // Assets types and extensions dictionary
 		const Type*              mStdAssetType;  // Standard asset type
@@ -163,6 +187,9 @@ namespace o2
 		// Initializes types extensions dictionary
 		void LoadAssetTypes();
 
+		// Starts asynchronous loading of asset with valid info
+		AssetRef LoadAsync(const AssetInfo& info, int priority, const Function<void(const AssetRef&)>& onLoaded);
+
 		// Returns asset cache by path
 		AssetCache* FindAssetCache(const String& path);
 
@@ -0,0 +1,423 @@
+#include "o2/stdafx.h"
+#include "AssetsLoader.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Assets/Types/AtlasAsset.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/ParallelFor.h"
+
+namespace o2
+{
+	AssetsLoader::AssetsLoader()
+	{
+		int threadsCount = Math::Clamp(GetWorkerThreadsCount()/2, 1, 4);
+		for (int i = 0; i < threadsCount; i++)
+			mThreads.Add(mnew std::thread([this]() { ThreadLoop(); }));
+	}
+
+	AssetsLoader::~AssetsLoader()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopping = true;
+		}
+
+		mQueuedCV.notify_all();
+
+		for (auto thread : mThreads)
+		{
+			thread->join();
+			delete thread;
+		}
+
+		for (auto request : mAssetRequests)
+			delete request;
+
+		for (auto& kv : mTextureRequests)
+		{
+			if (kv.second->bitmap)
+				delete kv.second->bitmap;
+
+			delete kv.second;
+		}
+	}
+
+	void AssetsLoader::Load(Asset* asset, int priority, const Function<void(Asset*)>& onLoaded)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		AssetRequest* request = nullptr;
+		if (mAssetRequestsByAsset.TryGetValue(asset, request))
+		{
+			request->priority = Math::Max(request->priority, priority);
+
+			if (!onLoaded.IsEmpty())
+				request->onLoaded.Add(onLoaded);
+
+			return;
+		}
+
+		request = mnew AssetRequest();
+		request->asset = asset;
+		request->builtFullPath = asset->GetBuiltFullPath();
+		request->priority = priority;
+
+		if (!onLoaded.IsEmpty())
+			request->onLoaded.Add(onLoaded);
+
+		mAssetRequests.Add(request);
+		mAssetRequestsByAsset.Add(asset, request);
+
+		mQueuedCV.notify_one();
+	}
+
+	bool AssetsLoader::IsLoading(const Asset* asset) const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mAssetRequestsByAsset.ContainsKey(asset);
+	}
+
+	void AssetsLoader::SetPriority(const Asset* asset, int priority)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		AssetRequest* request = nullptr;
+		if (!mAssetRequestsByAsset.TryGetValue(asset, request))
+			return;
+
+		request->priority = priority;
+
+		for (auto textureRequest : request->textures)
+			textureRequest->priority = Math::Max(textureRequest->priority, priority);
+	}
+
+	void AssetsLoader::Cancel(const Asset* asset)
+	{
+		AssetRequest* request = nullptr;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			if (!mAssetRequestsByAsset.TryGetValue(asset, request))
+				return;
+
+			// Loading thread reads asset, waiting for it before asset can be destroyed
+			mProcessedCV.wait(lock, [&]() { return request->state != State::Processing; });
+		}
+
+		RemoveRequest(request);
+		delete request;
+	}
+
+	void AssetsLoader::Complete(const Asset* asset)
+	{
+		AssetRequest* request = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mAssetRequestsByAsset.TryGetValue(asset, request))
+				return;
+		}
+
+		WaitProcessed(request);
+		FinishRequest(request);
+	}
+
+	void AssetsLoader::CompleteAll()
+	{
+		while (true)
+		{
+			const Asset* asset = nullptr;
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (mAssetRequests.IsEmpty())
+					return;
+
+				asset = mAssetRequests[0]->asset;
+			}
+
+			Complete(asset);
+		}
+	}
+
+	void AssetsLoader::Update()
+	{
+		Timer timer;
+
+		Vector<TextureRequest*> decodedTextures;
+		Vector<AssetRequest*> processedAssets;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+
+			for (auto& kv : mTextureRequests)
+			{
+				if (kv.second->state == State::Processed)
+					decodedTextures.Add(kv.second);
+			}
+
+			for (auto request : mAssetRequests)
+			{
+				if (request->state == State::Processed)
+					processedAssets.Add(request);
+			}
+		}
+
+		if (decodedTextures.IsEmpty() && processedAssets.IsEmpty())
+			return;
+
+		decodedTextures.Sort([](TextureRequest* a, TextureRequest* b) { return a->priority > b->priority; });
+		processedAssets.Sort([](AssetRequest* a, AssetRequest* b) { return a->priority > b->priority; });
+
+		// At least one texture and one asset is processed each frame, even when budget is too small
+		for (auto request : decodedTextures)
+		{
+			UploadTexture(request);
+
+			if (timer.GetTime() > mFrameTimeBudget)
+				break;
+		}
+
+		for (auto request : processedAssets)
+		{
+			// Callbacks can complete or cancel other requests
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (!mAssetRequests.Contains(request))
+					continue;
+			}
+
+			if (!RequestTextures(request))
+				continue;
+
+			FinishRequest(request);
+
+			if (timer.GetTime() > mFrameTimeBudget)
+				break;
+		}
+	}
+
+	void AssetsLoader::SetFrameTimeBudget(float seconds)
+	{
+		mFrameTimeBudget = seconds;
+	}
+
+	float AssetsLoader::GetFrameTimeBudget() const
+	{
+		return mFrameTimeBudget;
+	}
+
+	int AssetsLoader::GetLoadingAssetsCount() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mAssetRequests.Count();
+	}
+
+	void AssetsLoader::ThreadLoop()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		while (true)
+		{
+			AssetRequest* assetRequest = nullptr;
+			TextureRequest* textureRequest = nullptr;
+
+			mQueuedCV.wait(lock, [&]() { return mStopping || TakeQueuedRequest(assetRequest, textureRequest); });
+
+			if (mStopping)
+				return;
+
+			lock.unlock();
+
+			if (assetRequest)
+				ProcessRequest(assetRequest);
+			else
+				ProcessRequest(textureRequest);
+
+			lock.lock();
+
+			if (assetRequest)
+				assetRequest->state = State::Processed;
+			else
+				textureRequest->state = State::Processed;
+
+			mProcessedCV.notify_all();
+		}
+	}
+
+	bool AssetsLoader::TakeQueuedRequest(AssetRequest*& assetRequest, TextureRequest*& textureRequest)
+	{
+		for (auto request : mAssetRequests)
+		{
+			if (request->state == State::Queued && (!assetRequest || request->priority > assetRequest->priority))
+				assetRequest = request;
+		}
+
+		// Textures are blocking already read assets, so they are preferred with same priority
+		for (auto& kv : mTextureRequests)
+		{
+			TextureRequest* request = kv.second;
+			if (request->state == State::Queued && (!textureRequest || request->priority > textureRequest->priority))
+				textureRequest = request;
+		}
+
+		if (textureRequest && (!assetRequest || textureRequest->priority >= assetRequest->priority))
+		{
+			assetRequest = nullptr;
+			textureRequest->state = State::Processing;
+			return true;
+		}
+
+		if (assetRequest)
+		{
+			textureRequest = nullptr;
+			assetRequest->state = State::Processing;
+			return true;
+		}
+
+		return false;
+	}
+
+	void AssetsLoader::ProcessRequest(AssetRequest* request)
+	{
+		request->asset->PreloadData(request->builtFullPath, request->preload);
+	}
+
+	void AssetsLoader::ProcessRequest(TextureRequest* request)
+	{
+		Bitmap* bitmap = mnew Bitmap();
+		if (bitmap->Load(request->fileName, Bitmap::ImageType::Auto))
+			request->bitmap = bitmap;
+		else
+			delete bitmap;
+	}
+
+	void AssetsLoader::WaitProcessed(AssetRequest* request)
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		if (request->state == State::Queued)
+		{
+			request->state = State::Processing;
+			lock.unlock();
+
+			ProcessRequest(request);
+
+			lock.lock();
+			request->state = State::Processed;
+			return;
+		}
+
+		mProcessedCV.wait(lock, [&]() { return request->state == State::Processed; });
+	}
+
+	bool AssetsLoader::RequestTextures(AssetRequest* request)
+	{
+		for (auto& source : request->preload.textures)
+		{
+			String fileName = source.fileName;
+			Texture* texture = nullptr;
+
+			if (source.atlasAssetId != 0)
+			{
+				texture = o2Render.FindTexture(source.atlasAssetId, source.atlasPage);
+
+				if (!texture)
+				{
+					auto& atlasInfo = o2Assets.GetAssetInfo(source.atlasAssetId);
+					if (!atlasInfo.IsValid())
+						continue;
+
+					fileName = AtlasAsset::GetPageTextureFileName(atlasInfo, source.atlasPage);
+				}
+			}
+			else
+				texture = o2Render.FindTexture(fileName);
+
+			if (texture)
+			{
+				request->loadedTextures.Add(TextureRef(texture));
+				continue;
+			}
+
+			std::lock_guard<std::mutex> lock(mMutex);
+
+			TextureRequest* textureRequest = nullptr;
+			if (!mTextureRequests.TryGetValue(fileName, textureRequest))
+			{
+				textureRequest = mnew TextureRequest();
+				textureRequest->fileName = fileName;
+				textureRequest->atlasAssetId = source.atlasAssetId;
+				textureRequest->atlasPage = source.atlasPage;
+				mTextureRequests.Add(fileName, textureRequest);
+
+				mQueuedCV.notify_one();
+			}
+
+			textureRequest->priority = Math::Max(textureRequest->priority, request->priority);
+			request->textures.Add(textureRequest);
+		}
+
+		request->preload.textures.Clear();
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		return request->textures.IsEmpty();
+	}
+
+	void AssetsLoader::UploadTexture(TextureRequest* request)
+	{
+		Texture* texture = request->atlasAssetId != 0 ? o2Render.FindTexture(request->atlasAssetId, request->atlasPage) :
+			o2Render.FindTexture(request->fileName);
+
+		if (request->bitmap && !texture)
+		{
+			texture = mnew Texture();
+			texture->Create(request->fileName, request->bitmap, request->atlasAssetId, request->atlasPage);
+		}
+		else if (!request->bitmap)
+			o2Render.mLog->Error("Failed to load texture: " + request->fileName);
+
+		if (request->bitmap)
+			delete request->bitmap;
+
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		mTextureRequests.Remove(request->fileName);
+
+		for (auto assetRequest : mAssetRequests)
+		{
+			if (!assetRequest->textures.Contains(request))
+				continue;
+
+			assetRequest->textures.Remove(request);
+
+			if (texture)
+				assetRequest->loadedTextures.Add(TextureRef(texture));
+		}
+
+		delete request;
+	}
+
+	void AssetsLoader::FinishRequest(AssetRequest* request)
+	{
+		RemoveRequest(request);
+
+		request->asset->LoadPreloadedData(request->builtFullPath, request->preload);
+
+		for (auto& onLoaded : request->onLoaded)
+			onLoaded(request->asset);
+
+		delete request;
+	}
+
+	void AssetsLoader::RemoveRequest(AssetRequest* request)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		mAssetRequests.Remove(request);
+		mAssetRequestsByAsset.Remove(request->asset);
+	}
+}
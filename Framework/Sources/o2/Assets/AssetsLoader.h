@@ -0,0 +1,132 @@
+#pragma once
+
+#include "o2/Assets/Asset.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace o2
+{
+	class Bitmap;
+
+	// ------------------------------------------------------------------------------------------------
+	// Asynchronous assets loader. Built files are read, parsed and textures are decoded on background
+	// threads, then assets are deserialized and textures are uploaded on main thread in Update() within
+	// frame time budget. Requests with greater priority are processed first
+	// ------------------------------------------------------------------------------------------------
+	class AssetsLoader
+	{
+	public:
+		// Default constructor, starts loading threads
+		AssetsLoader();
+
+		// Destructor, stops loading threads and drops unfinished requests
+		~AssetsLoader();
+
+		// Starts asset loading. Asset must be registered in assets cache with actual info. Callback is called
+		// on main thread when asset is loaded
+		void Load(Asset* asset, int priority, const Function<void(Asset*)>& onLoaded);
+
+		// Returns true when asset is loading
+		bool IsLoading(const Asset* asset) const;
+
+		// Sets asset loading priority
+		void SetPriority(const Asset* asset, int priority);
+
+		// Cancels asset loading, asset stays not loaded and callbacks aren't called
+		void Cancel(const Asset* asset);
+
+		// Finishes asset loading immediately on current thread. Waits when asset is processing on loading thread
+		void Complete(const Asset* asset);
+
+		// Finishes all requests immediately
+		void CompleteAll();
+
+		// Processes loaded requests: uploads textures and finishes assets loading until frame time budget is spent
+		void Update();
+
+		// Sets main thread time budget in seconds for finishing assets loading per frame
+		void SetFrameTimeBudget(float seconds);
+
+		// Returns main thread time budget in seconds for finishing assets loading per frame
+		float GetFrameTimeBudget() const;
+
+		// Returns count of loading assets
+		int GetLoadingAssetsCount() const;
+
+	protected:
+		enum class State { Queued, Processing, Processed };
+
+		struct TextureRequest
+		{
+			String  fileName;               // Texture file name
+			UID     atlasAssetId = 0;       // Atlas asset id, 0 when texture isn't atlas page
+			int     atlasPage = -1;         // Atlas page index
+			int     priority = 0;           // Decoding priority, maximum of dependent assets priorities
+			State   state = State::Queued;  // Request state
+			Bitmap* bitmap = nullptr;       // Decoded bitmap, null when decoding failed
+		};
+
+		struct AssetRequest
+		{
+			Asset*           asset = nullptr;       // Loading asset
+			String           builtFullPath;         // Asset built file path
+			int              priority = 0;          // Loading priority
+			State            state = State::Queued; // Request state
+			AssetPreloadData preload;               // Data, read on loading thread
+
+			Vector<TextureRequest*>        textures;       // Not uploaded required textures requests
+			Vector<TextureRef>             loadedTextures; // Loaded required textures, they are kept until asset is finished
+			Vector<Function<void(Asset*)>> onLoaded;       // Loaded callbacks
+		};
+
+	protected:
+		Vector<std::thread*> mThreads;          // Loading threads
+		bool                 mStopping = false; // Is loader stopping, threads exit when it is true
+
+		mutable std::mutex      mMutex;       // Requests states and queues guard
+		std::condition_variable mQueuedCV;    // Notifies loading threads about new requests
+		std::condition_variable mProcessedCV; // Notifies waiting threads about processed requests
+
+		Vector<AssetRequest*>            mAssetRequests;        // Current assets requests
+		Map<const Asset*, AssetRequest*> mAssetRequestsByAsset; // Assets requests by asset
+		Map<String, TextureRequest*>     mTextureRequests;      // Current textures requests by file name
+
+		float mFrameTimeBudget = 0.004f; // Main thread time budget in seconds per frame
+
+	protected:
+		// Loading thread function. Takes requests with maximum priority and processes them
+		void ThreadLoop();
+
+		// Returns queued request with maximum priority, asset or texture. Must be called under lock
+		bool TakeQueuedRequest(AssetRequest*& assetRequest, TextureRequest*& textureRequest);
+
+		// Reads asset data on loading thread
+		void ProcessRequest(AssetRequest* request);
+
+		// Decodes texture on loading thread
+		void ProcessRequest(TextureRequest* request);
+
+		// Waits until asset request preloading finished, processes it on current thread if it is still queued
+		void WaitProcessed(AssetRequest* request);
+
+		// Creates textures requests for not loaded textures of asset, resolves atlas pages files names. Returns
+		// true when all textures are ready
+		bool RequestTextures(AssetRequest* request);
+
+		// Uploads decoded texture and removes request. Skips uploading when same texture is already loaded
+		void UploadTexture(TextureRequest* request);
+
+		// Applies preloaded data to asset, calls callbacks and removes request
+		void FinishRequest(AssetRequest* request);
+
+		// Removes asset request, request must not be processing on loading thread
+		void RemoveRequest(AssetRequest* request);
+	};
+}
@@ -183,11 +183,15 @@ namespace o2
 
 	AssetInfo* AssetsTree::LoadAssetNode(const String& path, AssetInfo* parent, const TimeStamp& time)
 	{
-		DataDocument metaData;
-		metaData.LoadFromFile(this->assetsPath + path + ".meta");
-
-		AssetMeta* meta = nullptr;;
-		meta = metaData;
+		AssetMeta* meta = nullptr;
+		if (!metaLoader.IsEmpty())
+			meta = metaLoader(path);
+		else
+		{
+			DataDocument metaData;
+			metaData.LoadFromFile(this->assetsPath + path + ".meta");
+			meta = metaData;
+		}
 
 		AssetInfo* asset = mnew AssetInfo();
 
@@ -25,6 +25,8 @@ namespace o2
 		Map<String, AssetInfo*> allAssetsByPath; // All assets by path
 		Map<UID, AssetInfo*>    allAssetsByUID;  // All assets by UID
 
+		Function<AssetMeta*(const String&)> metaLoader; // Asset meta loading function by asset path. When empty, meta is loaded from file
+
 	public:
 		// Default constructor
 		AssetsTree();
@@ -90,6 +92,7 @@ CLASS_FIELDS_META(o2::AssetsTree)
 	FIELD().NAME(allAssets).PUBLIC();
 	FIELD().NAME(allAssetsByPath).PUBLIC();
 	FIELD().NAME(allAssetsByUID).PUBLIC();
+	FIELD().NAME(metaLoader).PUBLIC();
 }
 END_META;
 CLASS_METHODS_META(o2::AssetsTree)
@@ -0,0 +1,193 @@
+#include "o2/stdafx.h"
+#include "AssetsBuildCache.h"
+
+#include "o2/Assets/Builder/IAssetConverter.h"
+#include "o2/Config/ProjectConfig.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tools/DataHash.h"
+
+#include <mutex>
+
+namespace o2
+{
+	// Guards cache records, build keys can be calculated and stored from worker threads
+	static std::mutex cacheMutex;
+
+	AssetsBuildCache::~AssetsBuildCache()
+	{
+		ClearMetas();
+	}
+
+	void AssetsBuildCache::Load(const String& indexPath, const String& storagePath)
+	{
+		mIndexPath = indexPath;
+		mStoragePath = storagePath;
+
+		ClearMetas();
+		mFiles.Clear();
+		mBuiltKeys.Clear();
+
+		DataDocument data;
+		if (data.LoadFromFile(mIndexPath))
+			Deserialize(data);
+	}
+
+	void AssetsBuildCache::Save() const
+	{
+		DataDocument data;
+		Serialize(data);
+		data.SaveToFile(mIndexPath, DataDocument::Format::Binary);
+	}
+
+	void AssetsBuildCache::ResetBuiltKeys()
+	{
+		mBuiltKeys.Clear();
+	}
+
+	UInt64 AssetsBuildCache::GetFileHash(const String& path, const String& fullPath)
+	{
+		FileInfo info = o2FileSystem.GetFileInfo(fullPath);
+
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			FileState* state = nullptr;
+			if (UpdateFileState(path, info, state))
+				return state->hash;
+		}
+
+		UInt64 hash = 0;
+		InFile file(fullPath);
+		if (file.IsOpened())
+		{
+			UInt size = file.GetDataSize();
+			if (char* data = file.MapFullData())
+				hash = GetDataHash(data, size);
+			else
+			{
+				Vector<char> data;
+				data.Resize(size);
+				file.ReadData(data.Data(), size);
+				hash = GetDataHash(data.Data(), size);
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		mFiles[path].hash = hash;
+
+		return hash;
+	}
+
+	AssetMeta* AssetsBuildCache::LoadMeta(const String& path, const String& fullPath)
+	{
+		String metaPath = path + ".meta";
+		String metaFullPath = fullPath + ".meta";
+		FileInfo metaInfo = o2FileSystem.GetFileInfo(metaFullPath);
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		FileState* state = nullptr;
+		bool actual = UpdateFileState(metaPath, metaInfo, state);
+
+		AssetMeta* cached = nullptr;
+		if (actual && mMetas.TryGetValue(path, cached) && cached)
+			return cached->CloneAs<AssetMeta>();
+
+		DataDocument metaData;
+		metaData.LoadFromFile(metaFullPath);
+
+		AssetMeta* meta = nullptr;
+		meta = metaData;
+
+		if (cached)
+			delete cached;
+
+		mMetas[path] = meta ? meta->CloneAs<AssetMeta>() : nullptr;
+
+		return meta;
+	}
+
+	UInt64 AssetsBuildCache::GetBuildKey(const AssetInfo& asset, const String& sourceFullPath, IAssetConverter* converter)
+	{
+		UInt64 sourceHash = o2FileSystem.IsFileExist(sourceFullPath) ? GetFileHash(asset.path, sourceFullPath) : 0;
+
+		DataDocument metaData;
+		metaData = asset.meta;
+		UInt64 metaHash = GetDataHash(metaData.SaveAsString().Data());
+
+		UInt64 converterHash = GetDataHash(converter->GetType().GetName().Data(), (UInt64)converter->GetVersion());
+		UInt64 settingsHash = o2Config.binaryBuiltAssets ? 1 : 0;
+
+		return CombineHash(CombineHash(sourceHash, metaHash), CombineHash(converterHash, settingsHash));
+	}
+
+	bool AssetsBuildCache::IsBuilt(const UID& id, UInt64 key) const
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		UInt64 builtKey = 0;
+		return mBuiltKeys.TryGetValue(id, builtKey) && builtKey == key;
+	}
+
+	void AssetsBuildCache::SetBuilt(const UID& id, UInt64 key)
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		mBuiltKeys[id] = key;
+	}
+
+	void AssetsBuildCache::RemoveBuilt(const UID& id)
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		mBuiltKeys.Remove(id);
+	}
+
+	bool AssetsBuildCache::RestoreBuiltFile(UInt64 key, const String& builtFullPath) const
+	{
+		String storedPath = GetStoredFilePath(key);
+		if (!o2FileSystem.IsFileExist(storedPath))
+			return false;
+
+		return o2FileSystem.FileCopy(storedPath, builtFullPath);
+	}
+
+	void AssetsBuildCache::StoreBuiltFile(UInt64 key, const String& builtFullPath) const
+	{
+		if (o2FileSystem.IsFileExist(builtFullPath))
+			o2FileSystem.FileCopy(builtFullPath, GetStoredFilePath(key));
+	}
+
+	bool AssetsBuildCache::UpdateFileState(const String& path, const FileInfo& info, FileState*& state)
+	{
+		auto fnd = mFiles.find(path);
+		if (fnd == mFiles.end())
+			fnd = mFiles.insert({ path, FileState() }).first;
+
+		state = &fnd->second;
+
+		if (state->editTime == info.editDate && state->size == info.size)
+			return true;
+
+		state->editTime = info.editDate;
+		state->size = info.size;
+		return false;
+	}
+
+	String AssetsBuildCache::GetStoredFilePath(UInt64 key) const
+	{
+		char name[17];
+		snprintf(name, sizeof(name), "%016llx", key);
+		return mStoragePath + name;
+	}
+
+	void AssetsBuildCache::ClearMetas()
+	{
+		for (auto& kv : mMetas)
+			delete kv.second;
+
+		mMetas.Clear();
+	}
+}
+
+DECLARE_CLASS(o2::AssetsBuildCache);
+
+DECLARE_CLASS(o2::AssetsBuildCache::FileState);
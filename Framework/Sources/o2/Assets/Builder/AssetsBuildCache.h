@@ -0,0 +1,142 @@
+#pragma once
+
+#include "o2/Assets/AssetInfo.h"
+#include "o2/Assets/Meta.h"
+#include "o2/Utils/Serialization/Serializable.h"
+#include "o2/Utils/System/Time/TimeStamp.h"
+#include "o2/Utils/Types/Containers/Map.h"
+
+namespace o2
+{
+	class IAssetConverter;
+
+	// ------------------------------------------------------------------------------------------------
+	// Assets build cache. Keeps source files content hashes, parsed metas and keys of built assets,
+	// so touched but unchanged assets are not converted again. Built files of cacheable converters are
+	// stored by key in shared storage folder, so identical results are reused between branches.
+	// Hashes, build keys and built files can be requested from worker threads
+	// ------------------------------------------------------------------------------------------------
+	class AssetsBuildCache: public ISerializable
+	{
+	public:
+		// -------------------------------
+		// Cached source file state record
+		// -------------------------------
+		struct FileState: public ISerializable
+		{
+			TimeStamp editTime; // File edit time @SERIALIZABLE
+			Int64     size = 0; // File size @SERIALIZABLE
+			UInt64    hash = 0; // File content hash @SERIALIZABLE
+
+			SERIALIZABLE(FileState);
+		};
+
+	public:
+		// Destructor
+		~AssetsBuildCache();
+
+		// Loads cache index from file. Built files are stored in storage folder
+		void Load(const String& indexPath, const String& storagePath);
+
+		// Saves cache index
+		void Save() const;
+
+		// Removes built assets keys, keeps files hashes and stored built files
+		void ResetBuiltKeys();
+
+		// Returns file content hash. Content is hashed again only when file edit time or size changed
+		UInt64 GetFileHash(const String& path, const String& fullPath);
+
+		// Returns copy of asset meta. Takes it from cache when meta file wasn't changed, otherwise loads meta file
+		AssetMeta* LoadMeta(const String& path, const String& fullPath);
+
+		// Returns asset build key: hash of source content, meta, converter version and build settings
+		UInt64 GetBuildKey(const AssetInfo& asset, const String& sourceFullPath, IAssetConverter* converter);
+
+		// Returns true when asset was built last time with same key
+		bool IsBuilt(const UID& id, UInt64 key) const;
+
+		// Stores asset build key
+		void SetBuilt(const UID& id, UInt64 key);
+
+		// Removes asset build key
+		void RemoveBuilt(const UID& id);
+
+		// Copies stored built file by key into built path. Returns false when there is no stored file for key
+		bool RestoreBuiltFile(UInt64 key, const String& builtFullPath) const;
+
+		// Stores built file copy by key
+		void StoreBuiltFile(UInt64 key, const String& builtFullPath) const;
+
+		SERIALIZABLE(AssetsBuildCache);
+
+	protected:
+		String mIndexPath;   // Cache index file path
+		String mStoragePath; // Stored built files folder path
+
+		Map<String, FileState>  mFiles;     // Source files states by path @SERIALIZABLE
+		Map<String, AssetMeta*> mMetas;     // Parsed metas by asset path @SERIALIZABLE
+		Map<UID, UInt64>        mBuiltKeys; // Keys of built assets @SERIALIZABLE
+
+	protected:
+		// Returns true when file state is cached and file isn't changed since, updates state edit time and size
+		bool UpdateFileState(const String& path, const FileInfo& info, FileState*& state);
+
+		// Returns stored built file path by key
+		String GetStoredFilePath(UInt64 key) const;
+
+		// Removes all cached metas
+		void ClearMetas();
+	};
+}
+
+CLASS_BASES_META(o2::AssetsBuildCache)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::AssetsBuildCache)
+{
+	FIELD().NAME(mIndexPath).PROTECTED();
+	FIELD().NAME(mStoragePath).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mFiles).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mMetas).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mBuiltKeys).PROTECTED();
+}
+END_META;
+CLASS_METHODS_META(o2::AssetsBuildCache)
+{
+
+	PUBLIC_FUNCTION(void, Load, const String&, const String&);
+	PUBLIC_FUNCTION(void, Save);
+	PUBLIC_FUNCTION(void, ResetBuiltKeys);
+	PUBLIC_FUNCTION(UInt64, GetFileHash, const String&, const String&);
+	PUBLIC_FUNCTION(AssetMeta*, LoadMeta, const String&, const String&);
+	PUBLIC_FUNCTION(UInt64, GetBuildKey, const AssetInfo&, const String&, IAssetConverter*);
+	PUBLIC_FUNCTION(bool, IsBuilt, const UID&, UInt64);
+	PUBLIC_FUNCTION(void, SetBuilt, const UID&, UInt64);
+	PUBLIC_FUNCTION(void, RemoveBuilt, const UID&);
+	PUBLIC_FUNCTION(bool, RestoreBuiltFile, UInt64, const String&);
+	PUBLIC_FUNCTION(void, StoreBuiltFile, UInt64, const String&);
+	PROTECTED_FUNCTION(bool, UpdateFileState, const String&, const FileInfo&, FileState*&);
+	PROTECTED_FUNCTION(String, GetStoredFilePath, UInt64);
+	PROTECTED_FUNCTION(void, ClearMetas);
+}
+END_META;
+
+CLASS_BASES_META(o2::AssetsBuildCache::FileState)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::AssetsBuildCache::FileState)
+{
+	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(editTime).PUBLIC();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(size).PUBLIC();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0).NAME(hash).PUBLIC();
+}
+END_META;
+CLASS_METHODS_META(o2::AssetsBuildCache::FileState)
+{
+}
+END_META;
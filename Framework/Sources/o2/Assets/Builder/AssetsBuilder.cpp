@@ -11,6 +11,7 @@
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/ParallelFor.h"
 
 namespace o2
 {
@@ -41,8 +42,14 @@ namespace o2
 
 		Timer timer;
 
+		mBuildCache.Load(o2FileSystem.GetFileNameWithoutExtension(mBuiltAssetsTreePath) + ".cache",
+						 o2FileSystem.GetParentPath(mBuiltAssetsTreePath) + "/BuildCache/");
+
 		if (forcible)
+		{
 			RemoveBuiltAssets();
+			mBuildCache.ResetBuiltKeys();
+		}
 
 		CheckBasicAtlas();
 
@@ -50,8 +57,10 @@ namespace o2
 		folderInfo.ClampPathNames();
 
 		ProcessMissingMetasCreation(folderInfo);
+		GenerateMissingMetas();
 
 		mSourceAssetsTree.assetsPath = assetsPath;
+		mSourceAssetsTree.metaLoader = [&](const String& path) { return mBuildCache.LoadMeta(path, mSourceAssetsPath + path); };
 		mSourceAssetsTree.Build(folderInfo);
 
 		DataDocument builtAssetsTreeDoc;
@@ -61,15 +70,20 @@ namespace o2
 		ProcessRemovedAssets();
 		ProcessNewAssets();
 		ProcessModifiedAssets();
+		ConvertQueuedAssets();
 		ConvertersPostProcess();
 
-		if (!mModifiedAssets.IsEmpty())
+		if (!mModifiedAssets.IsEmpty() || mBuiltAssetsTreeChanged)
 		{
 			mBuiltAssetsTree->assetsPath = mSourceAssetsPath;
 			mBuiltAssetsTree->builtAssetsPath = mBuiltAssetsPath;
 			o2FileSystem.WriteFile(mBuiltAssetsTreePath, mBuiltAssetsTree->SerializeToString());
 		}
 
+		mBuildCache.Save();
+
+		LogConvertersStats();
+
 		mLog->Out("Completed for " + (String)timer.GetDeltaTime() + " seconds");
 
 		return mModifiedAssets;
@@ -140,7 +154,7 @@ namespace o2
 				if (!isExistMetaForAsset)
 				{
 					auto assetType = o2Assets.GetAssetTypeByExtension(o2FileSystem.GetFileExtension(fileInfo.path));
-					GenerateMeta(*assetType, metaFullPath);
+					mMissingMetas.Add({ assetType, metaFullPath });
 				}
 			}
 		}
@@ -152,8 +166,7 @@ namespace o2
 			bool isExistMetaForFolder = o2FileSystem.IsFileExist(metaFullPath);
 			if (!isExistMetaForFolder)
 			{
-				auto& assetType = TypeOf(FolderAsset);
-				GenerateMeta(assetType, metaFullPath);
+				mMissingMetas.Add({ &TypeOf(FolderAsset), metaFullPath });
 			}
 
 			ProcessMissingMetasCreation(subFolder);
@@ -192,6 +205,7 @@ namespace o2
 				GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
 				mModifiedAssets.Add(builtAssetInfo->meta->ID());
+				mBuildCache.RemoveBuilt(builtAssetInfo->meta->ID());
 
 				mLog->OutStr("Removed asset: " + builtAssetInfo->path);
 
@@ -214,6 +228,20 @@ namespace o2
 
 		mSourceAssetsTree.SortAssets();
 
+		// Hashing changed assets sources on worker threads to find just touched assets
+		Vector<const AssetInfo*> changedAssets;
+		for (auto sourceAssetInfo : mSourceAssetsTree.allAssets)
+		{
+			AssetInfo* builtAssetInfo = nullptr;
+			if (mBuiltAssetsTree->allAssetsByUID.TryGetValue(sourceAssetInfo->meta->ID(), builtAssetInfo) &&
+				(sourceAssetInfo->editTime != builtAssetInfo->editTime || !sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta)))
+			{
+				changedAssets.Add(sourceAssetInfo);
+			}
+		}
+
+		CalculateBuildKeys(changedAssets);
+
 		// in first pass processing folders, in second - files
 		for (int pass = 0; pass < 2; pass++)
 		{
@@ -234,7 +262,15 @@ namespace o2
 						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
 							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
 						{
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							// Source file could be just touched, checking content
+							if (IsBuiltAssetActual(*sourceAssetInfo))
+							{
+								builtAssetInfo->editTime = sourceAssetInfo->editTime;
+								mBuiltAssetsTreeChanged = true;
+								continue;
+							}
+
+							mConvertQueue.Add(sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -262,7 +298,7 @@ namespace o2
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							mConvertQueue.Add(sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 							mBuiltAssetsTree->AddAsset(builtAssetInfo);
@@ -314,7 +350,7 @@ namespace o2
 				if (!isNew)
 					continue;
 
-				GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				mConvertQueue.Add(sourceAssetInfo);
 
 				mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -333,23 +369,169 @@ namespace o2
 	void AssetsBuilder::ConvertersPostProcess()
 	{
 		for (auto it = mAssetConverters.Begin(); it != mAssetConverters.End(); ++it)
+		{
+			Timer timer;
 			mModifiedAssets.Add(it->second->AssetsPostProcess());
+			mConvertersStats[it->second].postProcessTime += timer.GetTime();
+		}
 
+		Timer timer;
 		mModifiedAssets.Add(mStdAssetConverter.AssetsPostProcess());
+		mConvertersStats[&mStdAssetConverter].postProcessTime += timer.GetTime();
 	}
 
-	void AssetsBuilder::GenerateMeta(const Type& assetType, const String& metaFullPath)
+	void AssetsBuilder::ConvertQueuedAssets()
 	{
-		auto assetTypeSample = (Asset*)assetType.CreateSample();
-		auto assetTypeSampleMeta = assetTypeSample->GetMeta();
+		const Type* folderType = &TypeOf(FolderAsset);
+
+		Vector<ConvertJob> folderJobs, mainThreadJobs, workerJobs;
+		for (auto assetInfo : mConvertQueue)
+		{
+			ConvertJob job;
+			job.assetInfo = assetInfo;
+			job.converter = GetAssetConverter(assetInfo->meta->GetAssetType());
+
+			if (assetInfo->meta->GetAssetType() == folderType)
+				folderJobs.Add(job);
+			else if (job.converter->IsThreadSafe())
+				workerJobs.Add(job);
+			else
+				mainThreadJobs.Add(job);
+		}
+
+		Timer timer;
+
+		// Folders are created first in depth order, then other assets are converted into them. Converters
+		// post processing (atlases) goes after all
+		for (auto& job : folderJobs)
+			ConvertAsset(job);
+
+		for (auto& job : mainThreadJobs)
+			ConvertAsset(job);
+
+		ParallelFor(workerJobs.Count(), [&](int idx) { ConvertAsset(workerJobs[idx]); });
+
+		for (auto jobs : { &folderJobs, &mainThreadJobs, &workerJobs })
+		{
+			for (auto& job : *jobs)
+			{
+				mBuildCache.SetBuilt(job.assetInfo->meta->ID(), job.buildKey);
+
+				auto& stats = mConvertersStats[job.converter];
+				stats.assetsCount++;
+				stats.convertTime += job.time;
 
-		DataDocument metaData;
-		metaData = assetTypeSampleMeta;
-		metaData["Value"]["mId"] = UID();
+				if (job.restoredFromCache)
+					mLog->Out("Restored from build cache asset: " + job.assetInfo->path);
+			}
+		}
+
+		if (!mConvertQueue.IsEmpty())
+		{
+			mLog->Out("Converted " + (String)mConvertQueue.Count() + " assets for " + (String)timer.GetTime() +
+					  " seconds, " + (String)workerJobs.Count() + " on worker threads");
+		}
+
+		mConvertQueue.Clear();
+	}
+
+	void AssetsBuilder::ConvertAsset(ConvertJob& job)
+	{
+		Timer timer;
+
+		const AssetInfo& assetInfo = *job.assetInfo;
+		if (!mBuildKeys.TryGetValue(assetInfo.meta->ID(), job.buildKey))
+			job.buildKey = mBuildCache.GetBuildKey(assetInfo, mSourceAssetsPath + assetInfo.path, job.converter);
+
+		if (job.converter->IsBuiltFileCacheable(assetInfo))
+		{
+			String builtFullPath = mBuiltAssetsPath + assetInfo.path;
+			if (mBuildCache.RestoreBuiltFile(job.buildKey, builtFullPath))
+			{
+				o2FileSystem.SetFileEditDate(builtFullPath, assetInfo.editTime);
+				job.restoredFromCache = true;
+			}
+			else
+			{
+				job.converter->ConvertAsset(assetInfo);
+				mBuildCache.StoreBuiltFile(job.buildKey, builtFullPath);
+			}
+		}
+		else
+			job.converter->ConvertAsset(assetInfo);
+
+		job.time = timer.GetTime();
+	}
+
+	void AssetsBuilder::CalculateBuildKeys(const Vector<const AssetInfo*>& assets)
+	{
+		Vector<UInt64> keys;
+		keys.Resize(assets.Count());
+
+		ParallelFor(assets.Count(), [&](int idx) {
+			const AssetInfo* assetInfo = assets[idx];
+			IAssetConverter* converter = GetAssetConverter(assetInfo->meta->GetAssetType());
+			keys[idx] = mBuildCache.GetBuildKey(*assetInfo, mSourceAssetsPath + assetInfo->path, converter);
+		});
+
+		for (int i = 0; i < assets.Count(); i++)
+			mBuildKeys[assets[i]->meta->ID()] = keys[i];
+	}
+
+	bool AssetsBuilder::IsBuiltAssetActual(const AssetInfo& sourceAssetInfo)
+	{
+		UInt64 buildKey = 0;
+		if (!mBuildKeys.TryGetValue(sourceAssetInfo.meta->ID(), buildKey))
+		{
+			IAssetConverter* converter = GetAssetConverter(sourceAssetInfo.meta->GetAssetType());
+			buildKey = mBuildCache.GetBuildKey(sourceAssetInfo, mSourceAssetsPath + sourceAssetInfo.path, converter);
+		}
+
+		return mBuildCache.IsBuilt(sourceAssetInfo.meta->ID(), buildKey);
+	}
+
+	void AssetsBuilder::LogConvertersStats()
+	{
+		for (auto& kv : mConvertersStats)
+		{
+			if (kv.second.assetsCount == 0 && kv.second.postProcessTime < 0.001f)
+				continue;
+
+			mLog->Out(kv.first->GetType().GetName() + ": " + (String)kv.second.assetsCount + " assets, converting " +
+					  (String)kv.second.convertTime + " seconds, post processing " + (String)kv.second.postProcessTime + 
+					  " seconds");
+		}
+	}
+
+	void AssetsBuilder::GenerateMissingMetas()
+	{
+		// Samples metas are created on main thread, then they are written with new ids on worker threads
+		Map<const Type*, String> samplesMetas;
+		Vector<UID> ids;
+		for (auto& missingMeta : mMissingMetas)
+		{
+			ids.Add(UID());
+
+			if (samplesMetas.ContainsKey(missingMeta.assetType))
+				continue;
+
+			auto assetTypeSample = (Asset*)missingMeta.assetType->CreateSample();
+
+			DataDocument metaData;
+			metaData = assetTypeSample->GetMeta();
+			samplesMetas.Add(missingMeta.assetType, metaData.SaveAsString());
+
+			delete assetTypeSample;
+		}
 
-		metaData.SaveToFile(metaFullPath);
+		ParallelFor(mMissingMetas.Count(), [&](int idx) {
+			DataDocument metaData;
+			metaData.LoadFromData(samplesMetas.Get(mMissingMetas[idx].assetType));
+			metaData["Value"]["mId"] = ids[idx];
+			metaData.SaveToFile(mMissingMetas[idx].metaFullPath);
+		});
 
-		delete assetTypeSample;
+		mMissingMetas.Clear();
 	}
 
 	IAssetConverter* AssetsBuilder::GetAssetConverter(const Type* assetType)
@@ -363,6 +545,11 @@ namespace o2
 	void AssetsBuilder::Reset()
 	{
 		mModifiedAssets.Clear();
+		mBuiltAssetsTreeChanged = false;
+		mConvertQueue.Clear();
+		mMissingMetas.Clear();
+		mBuildKeys.Clear();
+		mConvertersStats.Clear();
 		mSourceAssetsTree.Clear();
 		mBuiltAssetsTree->Clear();
 
@@ -3,6 +3,7 @@
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Assets/AssetsTree.h"
+#include "o2/Assets/Builder/AssetsBuildCache.h"
 #include "o2/Assets/Builder/StdAssetConverter.h"
 #include "o2/Utils/Types/String.h"
 
@@ -43,7 +44,39 @@ namespace o2
 		String      mBuiltAssetsTreePath; // Built assets tree data path
 		AssetsTree* mBuiltAssetsTree;     // Built assets tree
 
-		Vector<UID> mModifiedAssets; // Modified assets infos
+		struct ConvertJob
+		{
+			const AssetInfo* assetInfo = nullptr;       // Converting source asset info
+			IAssetConverter* converter = nullptr;       // Asset converter
+			UInt64           buildKey = 0;              // Asset build key, stored into cache after converting
+			bool             restoredFromCache = false; // Is built file restored from build cache
+			float            time = 0.0f;               // Converting time in seconds
+		};
+
+		struct ConverterStats
+		{
+			int   assetsCount = 0;        // Converted assets count
+			float convertTime = 0.0f;     // Summary converting time in seconds, sum of all threads time
+			float postProcessTime = 0.0f; // Post processing time in seconds
+		};
+
+		struct MissingMeta
+		{
+			const Type* assetType;    // Asset type
+			String      metaFullPath; // Meta file full path
+		};
+
+	protected:
+		Vector<UID> mModifiedAssets;                  // Modified assets infos
+		bool        mBuiltAssetsTreeChanged = false; // Is built assets tree changed without assets modifications, edit times updated
+
+		AssetsBuildCache mBuildCache; // Source files hashes, metas and built files cache
+
+		Vector<const AssetInfo*> mConvertQueue; // Source assets queued for converting
+		Map<UID, UInt64>         mBuildKeys;    // Precalculated build keys of changed assets
+		Vector<MissingMeta>      mMissingMetas; // Metas queued for generating
+
+		Map<IAssetConverter*, ConverterStats> mConvertersStats; // Converters time statistics of last build
 
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
@@ -69,12 +102,27 @@ namespace o2
 
 		// Launches converters post process
 		void ConvertersPostProcess();
+
+		// Converts queued assets: folders first, then assets with non thread safe converters, then others on worker threads
+		void ConvertQueuedAssets();
+
+		// Converts asset with job converter. Takes built file from build cache when it is possible. Can be called from worker thread
+		void ConvertAsset(ConvertJob& job);
+
+		// Calculates build keys of assets on worker threads
+		void CalculateBuildKeys(const Vector<const AssetInfo*>& assets);
+
+		// Returns true when asset is built from same source content, meta and converter version
+		bool IsBuiltAssetActual(const AssetInfo& sourceAssetInfo);
 		
 		// Processes folder for missing metas
 		void ProcessMissingMetasCreation(FolderInfo& folder);
 		
-		// Generates meta information file for asset
-		void GenerateMeta(const Type& assetType, const String& metaFullPath);
+		// Generates queued missing metas files on worker threads
+		void GenerateMissingMetas();
+
+		// Prints converters time statistics to log
+		void LogConvertersStats();
 
 		// Returns assets converter by asset type
 		IAssetConverter* GetAssetConverter(const Type* assetType);
@@ -4,9 +4,13 @@
 #include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Assets/Assets.h"
+#include "o2/Config/ProjectConfig.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tasks/ParallelFor.h"
+
+#include <atomic>
 
 namespace o2
 {
@@ -55,6 +59,11 @@ namespace o2
 		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
 	}
 
+	bool AtlasAssetConverter::IsThreadSafe() const
+	{
+		return true;
+	}
+
 	Vector<UID> AtlasAssetConverter::AssetsPostProcess()
 	{
 		CheckBasicAtlas();
@@ -180,6 +189,14 @@ namespace o2
 	}
 
 	void AtlasAssetConverter::RebuildAtlas(AssetInfo* atlasInfo, Vector<Image>& images)
+	{
+		if (o2Config.incrementalAtlasRebuild && UpdateAtlas(atlasInfo, images))
+			return;
+
+		RepackAtlas(atlasInfo, images);
+	}
+
+	void AtlasAssetConverter::RepackAtlas(AssetInfo* atlasInfo, Vector<Image>& images)
 	{
 		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
 
@@ -199,108 +216,298 @@ namespace o2
 				continue;
 			}
 
-			String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path;
-
-			// Load bitmap
-			Bitmap* bitmap = mnew Bitmap();
-			if (!bitmap->Load(assetFullPath))
-			{
-				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgInfo->path);
-				delete bitmap;
-				continue;
-			}
-
-			// Create packing rect
-			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize() +
-														 Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
-
 			ImagePackDef imagePackDef;
 			imagePackDef.assetInfo = imgInfo;
-			imagePackDef.bitmap = bitmap;
-			imagePackDef.packRect = packRect;
-
 			packImages.Add(imagePackDef);
 		}
 
+		// Load bitmaps
+		LoadImagesBitmaps(packImages);
+
+		// Create packing rects
+		for (auto& imgDef : packImages)
+			imgDef.packRect = packer.AddRect(imgDef.bitmap->GetSize() + Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
+
 		// Try to pack
 		if (!packer.Pack())
 		{
 			mAssetsBuilder->mLog->Error("Atlas " + atlasInfo->path + " packing failed");
+
+			for (auto& imgDef : packImages)
+				delete imgDef.bitmap;
+
 			return;
 		}
 		else mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed");
 
-		// Initialize bitmaps and pages
+		// Initialize pages
 		int pagesCount = packer.GetPagesCount();
-		Vector<Bitmap*> resAtlasBitmaps;
 		Vector<AtlasAsset::Page> resAtlasPages;
+		Vector<Vector<ImagePackDef*>> pagesImages;
 		for (int i = 0; i < pagesCount; i++)
 		{
+			pagesImages.Add(Vector<ImagePackDef*>());
+
 			AtlasAsset::Page atlasPage;
 			atlasPage.mId = i;
 			atlasPage.mSize = packer.GetMaxSize();
 			resAtlasPages.Add(atlasPage);
-
-			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, packer.GetMaxSize());
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-
-			resAtlasBitmaps.Add(newBitmap);
 		}
 
-		// Save image assets data and fill pages
-		for (auto imgDef : packImages)
+		// Save image assets data
+		for (auto& imgDef : packImages)
 		{
 			imgDef.packRect->rect.left += imagesBorder;
 			imgDef.packRect->rect.right -= imagesBorder;
 			imgDef.packRect->rect.top -= imagesBorder;
 			imgDef.packRect->rect.bottom += imagesBorder;
 
-			resAtlasBitmaps[imgDef.packRect->page]->CopyImage(imgDef.bitmap,
-															  imgDef.packRect->rect.LeftBottom());
-
 			resAtlasPages[imgDef.packRect->page].mImagesRects.Add(imgDef.assetInfo->meta->ID(),
 																  imgDef.packRect->rect);
 
-			SaveImageAsset(imgDef);
+			pagesImages[imgDef.packRect->page].Add(&imgDef);
+
+			SaveImageAsset(imgDef.assetInfo, imgDef.packRect->page, imgDef.packRect->rect);
 		}
 
-		// Save pages bitmaps
-		for (int i = 0; i < pagesCount; i++)
+		// Fill and save pages bitmaps
+		Vec2I pageSize = packer.GetMaxSize();
+		ParallelFor(pagesCount, [&](int page) {
+			Bitmap pageBitmap(PixelFormat::R8G8B8A8, pageSize);
+			pageBitmap.Fill(Color4(255, 255, 255, 0));
+
+			for (auto imgDef : pagesImages[page])
+				pageBitmap.CopyImage(imgDef->bitmap, imgDef->packRect->rect.LeftBottom());
+
+			pageBitmap.Save(GetAtlasPagePath(atlasInfo, page), Bitmap::ImageType::Png);
+		});
+
+		for (auto& imgDef : packImages)
+			delete imgDef.bitmap;
+
+		SaveAtlasData(atlasInfo, resAtlasPages, images);
+	}
+
+	bool AtlasAssetConverter::UpdateAtlas(AssetInfo* atlasInfo, Vector<Image>& images)
+	{
+		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
+		if (mAssetsBuilder->mModifiedAssets.Contains(meta->ID()))
+			return false;
+
+		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
+		if (!o2FileSystem.IsFileExist(atlasFullBuiltPath))
+			return false;
+
+		DataDocument atlasData;
+		if (!atlasData.LoadFromFile(atlasFullBuiltPath) || !atlasData.FindMember("mPages") || !atlasData.FindMember("mImages"))
+			return false;
+
+		Vector<AtlasAsset::Page> pages = atlasData["mPages"];
+		Vector<Image> lastImages = atlasData["mImages"];
+
+		for (auto& page : pages)
+		{
+			if (page.mSize != meta->windows.maxSize)
+				return false;
+		}
+
+		// Find changed images. Each of them must fit into its previous rectangle, otherwise atlas is repacked
+		Vector<ImagePackDef> changedImages;
+		Vector<int> changedImagesPages;
+		for (auto& img : images)
 		{
-			resAtlasBitmaps[i]->Save(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)i + ".png",
-									 Bitmap::ImageType::Png);
+			int lastImageIdx = lastImages.IndexOf(img);
+			if (lastImageIdx < 0)
+				return false;
 
-			delete resAtlasBitmaps[i];
+			if (lastImages[lastImageIdx].time == img.time && !mAssetsBuilder->mModifiedAssets.Contains(img.id))
+				continue;
+
+			int page = pages.IndexOf([&](const AtlasAsset::Page& page) { return page.mImagesRects.ContainsKey(img.id); });
+			if (page < 0)
+				return false;
+
+			AssetInfo* imgInfo = nullptr;
+			mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(img.id, imgInfo);
+			if (!imgInfo)
+				return false;
+
+			ImagePackDef imagePackDef;
+			imagePackDef.assetInfo = imgInfo;
+			changedImages.Add(imagePackDef);
+			changedImagesPages.Add(page);
 		}
 
-		// Save atlas data
+		// Find removed images
+		Vector<int> changedPages;
+		Vector<Vector<RectI>> removedRects;
+		for (int i = 0; i < pages.Count(); i++)
+			removedRects.Add(Vector<RectI>());
+
+		for (auto& lastImg : lastImages)
+		{
+			if (images.Contains(lastImg))
+				continue;
+
+			for (int i = 0; i < pages.Count(); i++)
+			{
+				RectI rect;
+				if (!pages[i].mImagesRects.TryGetValue(lastImg.id, rect))
+					continue;
+
+				pages[i].mImagesRects.Remove(lastImg.id);
+				removedRects[i].Add(rect);
+
+				if (!changedPages.Contains(i))
+					changedPages.Add(i);
+			}
+		}
+
+		for (auto page : changedImagesPages)
+		{
+			if (!changedPages.Contains(page))
+				changedPages.Add(page);
+		}
+
+		if (changedPages.IsEmpty())
+		{
+			SaveAtlasData(atlasInfo, pages, images);
+			return true;
+		}
+
+		// Load changed images and check their sizes
+		LoadImagesBitmaps(changedImages);
+
+		bool sizesFit = changedImages.Count() == changedImagesPages.Count();
+		for (int i = 0; i < changedImages.Count() && sizesFit; i++)
+		{
+			const RectI& rect = pages[changedImagesPages[i]].mImagesRects.Get(changedImages[i].assetInfo->meta->ID());
+			sizesFit = changedImages[i].bitmap->GetSize() == rect.Size();
+		}
+
+		if (!sizesFit)
+		{
+			for (auto& imgDef : changedImages)
+				delete imgDef.bitmap;
+
+			return false;
+		}
+
+		// Load previous pages bitmaps, patch and save them
+		std::atomic<bool> pagesLoaded(true);
+		ParallelFor(changedPages.Count(), [&](int changedPageIdx) {
+			int page = changedPages[changedPageIdx];
+
+			Bitmap pageBitmap;
+			if (!pageBitmap.Load(GetAtlasPagePath(atlasInfo, page), Bitmap::ImageType::Png) ||
+				pageBitmap.GetSize() != pages[page].mSize)
+			{
+				pagesLoaded = false;
+				return;
+			}
+
+			// Images are copied into page rows flipped vertically, but FillRect addresses rows directly
+			int pageHeight = pageBitmap.GetSize().y;
+			for (auto& rect : removedRects[page])
+			{
+				pageBitmap.FillRect(rect.left, pageHeight - rect.bottom, rect.right, pageHeight - rect.top, 
+									Color4(255, 255, 255, 0));
+			}
+
+			for (int i = 0; i < changedImages.Count(); i++)
+			{
+				if (changedImagesPages[i] != page)
+					continue;
+
+				const RectI& rect = pages[page].mImagesRects.Get(changedImages[i].assetInfo->meta->ID());
+				pageBitmap.CopyImage(changedImages[i].bitmap, rect.LeftBottom());
+			}
+
+			pageBitmap.Save(GetAtlasPagePath(atlasInfo, page), Bitmap::ImageType::Png);
+		});
+
+		for (auto& imgDef : changedImages)
+			delete imgDef.bitmap;
+
+		if (!pagesLoaded)
+			return false;
+
+		for (int i = 0; i < changedImages.Count(); i++)
+		{
+			AssetInfo* imgInfo = changedImages[i].assetInfo;
+			SaveImageAsset(imgInfo, changedImagesPages[i], pages[changedImagesPages[i]].mImagesRects.Get(imgInfo->meta->ID()));
+		}
+
+		mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " updated: " + (String)changedImages.Count() +
+								  " images changed, " + (String)changedPages.Count() +
+								  " pages saved");
+
+		SaveAtlasData(atlasInfo, pages, images);
+
+		return true;
+	}
+
+	void AtlasAssetConverter::LoadImagesBitmaps(Vector<ImagePackDef>& images)
+	{
+		Vector<String> paths;
+		for (auto& imgDef : images)
+			paths.Add(mAssetsBuilder->GetSourceAssetsPath() + imgDef.assetInfo->path);
+
+		ParallelFor(images.Count(), [&](int idx) {
+			Bitmap* bitmap = mnew Bitmap();
+			if (!bitmap->Load(paths[idx]))
+			{
+				delete bitmap;
+				bitmap = nullptr;
+			}
+
+			images[idx].bitmap = bitmap;
+		});
+
+		for (auto& imgDef : images)
+		{
+			if (!imgDef.bitmap)
+				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgDef.assetInfo->path);
+		}
+
+		images.RemoveAll([](const ImagePackDef& imgDef) { return imgDef.bitmap == nullptr; });
+	}
+
+	void AtlasAssetConverter::SaveAtlasData(AssetInfo* atlasInfo, const Vector<AtlasAsset::Page>& pages, 
+											const Vector<Image>& images)
+	{
 		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
 		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
 
 		DataDocument atlasData;
 		atlasData.LoadFromFile(atlasFullPath);
-		atlasData["mPages"] = resAtlasPages;
+		atlasData["mPages"] = pages;
 		atlasData["mImages"] = images;
 
 		atlasData.SaveToFile(atlasFullPath);
-		atlasData.SaveToFile(atlasFullBuiltPath);
+		atlasData.SaveToFile(atlasFullBuiltPath, o2Config.binaryBuiltAssets ? DataDocument::Format::Binary : DataDocument::Format::JSON);
 
 		o2FileSystem.SetFileEditDate(atlasFullPath, atlasInfo->editTime);
 		o2FileSystem.SetFileEditDate(atlasFullBuiltPath, atlasInfo->editTime);
 	}
 
-	void AtlasAssetConverter::SaveImageAsset(ImagePackDef& imgDef)
+	String AtlasAssetConverter::GetAtlasPagePath(AssetInfo* atlasInfo, int page) const
+	{
+		return mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)page + ".png";
+	}
+
+	void AtlasAssetConverter::SaveImageAsset(AssetInfo* imageInfo, int page, const RectI& rect)
 	{
 		DataDocument imgData;
-		imgData["mAtlasPage"] = imgDef.packRect->page;
-		imgData["mAtlasRect"] = (RectI)(imgDef.packRect->rect);
-		String imageFullPath = mAssetsBuilder->GetBuiltAssetsPath() + imgDef.assetInfo->path;
+		imgData["mAtlasPage"] = page;
+		imgData["mAtlasRect"] = rect;
+		String imageFullPath = mAssetsBuilder->GetBuiltAssetsPath() + imageInfo->path;
 		imgData.SaveToFile(imageFullPath);
-		o2FileSystem.SetFileEditDate(imageFullPath, imgDef.assetInfo->editTime);
+		o2FileSystem.SetFileEditDate(imageFullPath, imageInfo->editTime);
 
 		DataDocument metaData;
-		metaData = imgDef.assetInfo->meta;
-		metaData.SaveToFile(mAssetsBuilder->GetSourceAssetsPath() + imgDef.assetInfo->path + ".meta");
+		metaData = imageInfo->meta;
+		metaData.SaveToFile(mAssetsBuilder->GetSourceAssetsPath() + imageInfo->path + ".meta");
 	}
 
 	AtlasAssetConverter::Image::Image(const UID& id, const TimeStamp& time):
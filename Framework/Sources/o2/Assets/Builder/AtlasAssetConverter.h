@@ -2,6 +2,7 @@
 
 #include "IAssetConverter.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Utils/Tools/RectPacker.h"
 
 namespace o2
@@ -26,6 +27,9 @@ namespace o2
 		// Moves atlas
 		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
+		// Returns true, atlases are only touched in converting, rebuilding goes in post process
+		bool IsThreadSafe() const;
+
 		// Post processing atlases. Here checking atlases for rebuild
 		Vector<UID> AssetsPostProcess();
 
@@ -82,11 +86,27 @@ namespace o2
 		// Returns true if atlas needs to rebuild
 		bool IsAtlasNeedRebuild(Vector<Image>& currentImages, Vector<Image>& lastImages);
 
-		// Rebuilds atlas
+		// Rebuilds atlas. Updates previous atlas pages when it is possible, otherwise repacks atlas
 		void RebuildAtlas(AssetInfo* atlasInfo, Vector<Image>& images);
 
+		// Loads all atlas images, packs them and saves all pages
+		void RepackAtlas(AssetInfo* atlasInfo, Vector<Image>& images);
+
+		// Updates atlas keeping previous images placements, saves only changed pages. Returns false when 
+		// atlas can't be updated and must be repacked: new images added or changed images sizes
+		bool UpdateAtlas(AssetInfo* atlasInfo, Vector<Image>& images);
+
+		// Loads images bitmaps on worker threads, removes images that can't be loaded
+		void LoadImagesBitmaps(Vector<ImagePackDef>& images);
+
+		// Saves atlas pages and images data to source and built atlas files
+		void SaveAtlasData(AssetInfo* atlasInfo, const Vector<AtlasAsset::Page>& pages, const Vector<Image>& images);
+
+		// Returns built atlas page bitmap path
+		String GetAtlasPagePath(AssetInfo* atlasInfo, int page) const;
+
 		// Saves image asset data
-		void SaveImageAsset(ImagePackDef& imgDef);
+		void SaveImageAsset(AssetInfo* imageInfo, int page, const RectI& rect);
 	};
 }
 
@@ -106,6 +126,7 @@ CLASS_METHODS_META(o2::AtlasAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsThreadSafe);
 	PUBLIC_FUNCTION(Vector<UID>, AssetsPostProcess);
 	PUBLIC_FUNCTION(void, Reset);
 	PROTECTED_FUNCTION(void, CheckBasicAtlas);
@@ -113,7 +134,12 @@ CLASS_METHODS_META(o2::AtlasAssetConverter)
 	PROTECTED_FUNCTION(bool, CheckAtlasRebuilding, AssetInfo*);
 	PROTECTED_FUNCTION(bool, IsAtlasNeedRebuild, Vector<Image>&, Vector<Image>&);
 	PROTECTED_FUNCTION(void, RebuildAtlas, AssetInfo*, Vector<Image>&);
-	PROTECTED_FUNCTION(void, SaveImageAsset, ImagePackDef&);
+	PROTECTED_FUNCTION(void, RepackAtlas, AssetInfo*, Vector<Image>&);
+	PROTECTED_FUNCTION(bool, UpdateAtlas, AssetInfo*, Vector<Image>&);
+	PROTECTED_FUNCTION(void, LoadImagesBitmaps, Vector<ImagePackDef>&);
+	PROTECTED_FUNCTION(void, SaveAtlasData, AssetInfo*, const Vector<AtlasAsset::Page>&, const Vector<Image>&);
+	PROTECTED_FUNCTION(String, GetAtlasPagePath, AssetInfo*, int);
+	PROTECTED_FUNCTION(void, SaveImageAsset, AssetInfo*, int, const RectI&);
 }
 END_META;
 
@@ -27,6 +27,21 @@ namespace o2
 	void IAssetConverter::Reset()
 	{}
 
+	int IAssetConverter::GetVersion() const
+	{
+		return 1;
+	}
+
+	bool IAssetConverter::IsBuiltFileCacheable(const AssetInfo& node) const
+	{
+		return false;
+	}
+
+	bool IAssetConverter::IsThreadSafe() const
+	{
+		return false;
+	}
+
 	void IAssetConverter::SetAssetsBuilder(AssetsBuilder* builder)
 	{
 		mAssetsBuilder = builder;
@@ -38,6 +38,16 @@ namespace o2
 		// Resets converter
 		virtual void Reset();
 
+		// Returns converter version. Must be increased when converting result changes, it invalidates build cache
+		virtual int GetVersion() const;
+
+		// Returns true when converted asset is single built file, that depends only on source file and meta. Such 
+		// files are stored in build cache and reused instead of converting
+		virtual bool IsBuiltFileCacheable(const AssetInfo& node) const;
+
+		// Returns true when ConvertAsset can be called from worker threads simultaneously for different assets
+		virtual bool IsThreadSafe() const;
+
 		// Sets owner assets builder
 		void SetAssetsBuilder(AssetsBuilder* builder);
 
@@ -68,6 +78,9 @@ CLASS_METHODS_META(o2::IAssetConverter)
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
 	PUBLIC_FUNCTION(Vector<UID>, AssetsPostProcess);
 	PUBLIC_FUNCTION(void, Reset);
+	PUBLIC_FUNCTION(int, GetVersion);
+	PUBLIC_FUNCTION(bool, IsBuiltFileCacheable, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsThreadSafe);
 	PUBLIC_FUNCTION(void, SetAssetsBuilder, AssetsBuilder*);
 }
 END_META;
@@ -22,6 +22,9 @@ namespace o2
 		// Moves image to new path
 		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
+		// Returns true, images are converted independently
+		bool IsThreadSafe() const;
+
 		IOBJECT(ImageAssetConverter);
 	};
 }
@@ -42,5 +45,6 @@ CLASS_METHODS_META(o2::ImageAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsThreadSafe);
 }
 END_META;
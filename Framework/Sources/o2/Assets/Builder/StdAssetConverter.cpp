@@ -5,6 +5,7 @@
 #include "o2/Assets/Types/BinaryAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
 #include "o2/Assets/Types/ImageAsset.h"
+#include "o2/Config/ProjectConfig.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 
 namespace o2
@@ -21,10 +22,44 @@ namespace o2
 		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
 		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
 
-		o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+		if (!IsConvertingToBinary(node) || !ConvertDataToBinary(node, sourceAssetPath, buildedAssetPath))
+			o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+
 		o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
 	}
 
+	bool StdAssetConverter::IsBuiltFileCacheable(const AssetInfo& node) const
+	{
+		return IsConvertingToBinary(node);
+	}
+
+	bool StdAssetConverter::IsThreadSafe() const
+	{
+		return true;
+	}
+
+	bool StdAssetConverter::IsConvertingToBinary(const AssetInfo& node) const
+	{
+		return o2Config.binaryBuiltAssets && node.meta && !node.meta->GetAssetType()->IsBasedOn(TypeOf(BinaryAsset));
+	}
+
+	bool StdAssetConverter::ConvertDataToBinary(const AssetInfo& node, const String& sourcePath, const String& builtPath)
+	{
+		String source = o2FileSystem.ReadFile(sourcePath);
+		int firstSymbol = 0;
+		while (firstSymbol < source.Length() && isspace(source[firstSymbol]))
+			firstSymbol++;
+
+		if (firstSymbol == source.Length() || source[firstSymbol] != '{')
+			return false;
+
+		DataDocument data;
+		if (!data.LoadFromData(source))
+			return false;
+
+		return data.SaveToFile(builtPath, DataDocument::Format::Binary);
+	}
+
 	void StdAssetConverter::RemoveAsset(const AssetInfo& node)
 	{
 		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
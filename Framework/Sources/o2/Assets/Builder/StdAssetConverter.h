@@ -13,7 +13,7 @@ namespace o2
 		// Returns vector of processing assets types
 		Vector<const Type*> GetProcessingAssetsTypes() const;
 
-		// Copies asset
+		// Copies asset. Converts data assets into binary format when it is enabled in project config
 		void ConvertAsset(const AssetInfo& node);
 
 		// Removes asset
@@ -22,7 +22,20 @@ namespace o2
 		// Moves asset to new path
 		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
+		// Returns true when asset is converted into binary format. Files copied without changing aren't cached
+		bool IsBuiltFileCacheable(const AssetInfo& node) const;
+
+		// Returns true, assets are copied or converted independently
+		bool IsThreadSafe() const;
+
 		IOBJECT(StdAssetConverter);
+
+	protected:
+		// Returns true when asset is data asset and data assets are converted into binary format
+		bool IsConvertingToBinary(const AssetInfo& node) const;
+
+		// Saves data asset source in binary format. Returns false when source isn't data document
+		bool ConvertDataToBinary(const AssetInfo& node, const String& sourcePath, const String& builtPath);
 	};
 }
 
@@ -42,5 +55,9 @@ CLASS_METHODS_META(o2::StdAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsBuiltFileCacheable, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsThreadSafe);
+	PROTECTED_FUNCTION(bool, IsConvertingToBinary, const AssetInfo&);
+	PROTECTED_FUNCTION(bool, ConvertDataToBinary, const AssetInfo&, const String&, const String&);
 }
 END_META;
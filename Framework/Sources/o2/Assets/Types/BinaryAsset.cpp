@@ -97,6 +97,33 @@ namespace o2
 		file.ReadFullData(mData);
 	}
 
+	void BinaryAsset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{
+		InFile file(path);
+		if (!file.IsOpened())
+			return;
+
+		preload.rawDataSize = file.GetDataSize();
+		preload.rawData = mnew char[preload.rawDataSize];
+		file.ReadFullData(preload.rawData);
+	}
+
+	void BinaryAsset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{
+		if (!preload.rawData)
+		{
+			GetAssetsLogStream()->Error("Failed to load binary asset data: can't open file " + path);
+			return;
+		}
+
+		if (mData)
+			delete[] mData;
+
+		mData = preload.rawData;
+		mDataSize = preload.rawDataSize;
+		preload.rawData = nullptr;
+	}
+
 	void BinaryAsset::SaveData(const String& path) const
 	{
 		OutFile file(path);
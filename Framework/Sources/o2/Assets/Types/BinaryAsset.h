@@ -52,6 +52,12 @@ namespace o2
 		// Loads asset data, using DataValue and serialization
 		void LoadData(const String& path) override;
 
+		// Reads raw file data on loading thread
+		void PreloadData(const String& path, AssetPreloadData& preload) const override;
+
+		// Takes preloaded raw data
+		void LoadPreloadedData(const String& path, AssetPreloadData& preload) override;
+
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
@@ -83,6 +89,8 @@ CLASS_METHODS_META(o2::BinaryAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, PreloadData, const String&, AssetPreloadData&);
+	PROTECTED_FUNCTION(void, LoadPreloadedData, const String&, AssetPreloadData&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
 }
 END_META;
@@ -39,6 +39,14 @@ namespace o2
 		if (!mFont)
 			mFont = mnew BitmapFont(path);
 	}
+
+	void BitmapFontAsset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{}
+
+	void BitmapFontAsset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{
+		LoadData(path);
+	}
 }
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BitmapFontAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BitmapFontAsset>);
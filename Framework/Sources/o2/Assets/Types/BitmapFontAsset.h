@@ -53,6 +53,12 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Font isn't read on loading thread, it creates textures
+		void PreloadData(const String& path, AssetPreloadData& preload) const override;
+
+		// Loads font on main thread
+		void LoadPreloadedData(const String& path, AssetPreloadData& preload) override;
+
 		friend class Assets;
 	};
 
@@ -76,6 +82,8 @@ CLASS_METHODS_META(o2::BitmapFontAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, PreloadData, const String&, AssetPreloadData&);
+	PROTECTED_FUNCTION(void, LoadPreloadedData, const String&, AssetPreloadData&);
 }
 END_META;
 
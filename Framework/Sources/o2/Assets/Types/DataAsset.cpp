@@ -31,6 +31,11 @@ namespace o2
 		data.LoadFromFile(path);
 	}
 
+	void DataAsset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{
+		data = std::move(preload.data);
+	}
+
 	void DataAsset::SaveData(const String& path) const
 	{
 		data.SaveToFile(path);
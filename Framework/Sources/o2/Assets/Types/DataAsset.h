@@ -41,6 +41,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Takes data parsed on loading thread
+		void LoadPreloadedData(const String& path, AssetPreloadData& preload) override;
+
 		// Saves data
 		void SaveData(const String& path) const override;
 
@@ -68,6 +71,7 @@ CLASS_METHODS_META(o2::DataAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, LoadPreloadedData, const String&, AssetPreloadData&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
 }
 END_META;
@@ -31,6 +31,12 @@ namespace o2
 	void FolderAsset::LoadData(const String& path)
 	{}
 
+	void FolderAsset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{}
+
+	void FolderAsset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{}
+
 	void FolderAsset::SaveData(const String& path) const
 	{
 		if (!o2FileSystem.IsFolderExist(path))
@@ -37,6 +37,12 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Folder hasn't data to read
+		void PreloadData(const String& path, AssetPreloadData& preload) const override;
+
+		// Folder hasn't data to load
+		void LoadPreloadedData(const String& path, AssetPreloadData& preload) override;
+
 		// Saves asset data
 		void SaveData(const String& path) const override;
 
@@ -63,6 +69,8 @@ CLASS_METHODS_META(o2::FolderAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, PreloadData, const String&, AssetPreloadData&);
+	PROTECTED_FUNCTION(void, LoadPreloadedData, const String&, AssetPreloadData&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
 }
 END_META;
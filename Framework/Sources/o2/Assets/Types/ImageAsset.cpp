@@ -149,6 +149,22 @@ namespace o2
 			mBitmap->Save(GetFullPath(), Bitmap::ImageType::Png);
 	}
 
+	void ImageAsset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{
+		Asset::PreloadData(path, preload);
+
+		// Atlas page file name is resolved by assets loader on main thread, assets system isn't used here
+		UID atlasId = GetMeta()->atlasId;
+		auto pageNode = preload.data.FindMember("mAtlasPage");
+		if (atlasId != 0 && pageNode)
+		{
+			AssetPreloadData::TextureSource texture;
+			texture.atlasAssetId = atlasId;
+			texture.atlasPage = (int)*pageNode;
+			preload.textures.Add(texture);
+		}
+	}
+
 	void ImageAsset::LoadBitmap()
 	{
 		String assetFullPath = GetFullPath();
@@ -141,6 +141,9 @@ namespace o2
 		// Saves data
 		void SaveData(const String& path) const override;
 
+		// Reads data and requests atlas page texture decoding on loading thread
+		void PreloadData(const String& path, AssetPreloadData& preload) const override;
+
 		// Load bitmap
 		void LoadBitmap();
 
@@ -193,6 +196,7 @@ CLASS_METHODS_META(o2::ImageAsset)
 	PUBLIC_FUNCTION(Meta*, GetMeta);
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PreloadData, const String&, AssetPreloadData&);
 	PROTECTED_FUNCTION(void, LoadBitmap);
 }
 END_META;
@@ -108,6 +108,14 @@ namespace o2
 		GetMeta()->mAsset = this;
 	}
 
+	void VectorFontAsset::PreloadData(const String& path, AssetPreloadData& preload) const
+	{}
+
+	void VectorFontAsset::LoadPreloadedData(const String& path, AssetPreloadData& preload)
+	{
+		LoadData(path);
+	}
+
 	void VectorFontAsset::SaveData(const String& path) const
 	{}
 
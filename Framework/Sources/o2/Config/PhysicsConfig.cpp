@@ -1,4 +1,12 @@
 #include "o2/stdafx.h"
 #include "PhysicsConfig.h"
 
+ENUM_META(o2::PhysicsConfig::InterpolationMode)
+{
+	ENUM_ENTRY(Extrapolate);
+	ENUM_ENTRY(Interpolate);
+	ENUM_ENTRY(None);
+}
+END_ENUM_META;
+
 DECLARE_CLASS(o2::PhysicsConfig);
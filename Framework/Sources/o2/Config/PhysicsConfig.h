@@ -5,6 +5,15 @@ namespace o2
 {
 	class PhysicsConfig: public ISerializable
 	{
+	public:
+		// Rigid bodies transforms smoothing mode between fixed physics steps
+		enum class InterpolationMode
+		{
+			None,        // Transforms are set by last physics step
+			Interpolate, // Transforms are interpolated between two last physics steps, one step behind physics
+			Extrapolate  // Transforms are extrapolated from two last physics steps by velocity
+		};
+
 	public:
 		Vec2F gravity = Vec2F(0, -98.0f); // Gravity force @SERIALIZABLE
 
@@ -15,10 +24,14 @@ namespace o2
 
 		float debugDrawAlpha = 0.5f; // Debug draw transparency @SERIALIZABLE
 
+		InterpolationMode interpolation = InterpolationMode::None; // Rigid bodies transforms smoothing mode between fixed steps @SERIALIZABLE
+
 		SERIALIZABLE(PhysicsConfig);
 	};
 }
 
+PRE_ENUM_META(o2::PhysicsConfig::InterpolationMode);
+
 CLASS_BASES_META(o2::PhysicsConfig)
 {
 	BASE_CLASS(o2::ISerializable);
@@ -31,6 +44,7 @@ CLASS_FIELDS_META(o2::PhysicsConfig)
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(8).NAME(velocityIterations).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(3).NAME(positionIterations).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.5f).NAME(debugDrawAlpha).PUBLIC();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(InterpolationMode::None).NAME(interpolation).PUBLIC();
 }
 END_META;
 CLASS_METHODS_META(o2::PhysicsConfig)
@@ -27,6 +27,10 @@ namespace o2
 	public:
 		PhysicsConfig physics; // Physics world config @SERIALIZABLE
 
+		bool binaryBuiltAssets = false; // Are data assets saved in binary format when building @SERIALIZABLE
+
+		bool incrementalAtlasRebuild = true; // Are atlases updated with keeping images placements when possible @SERIALIZABLE
+
 	public:
 		// Default constructor
 		ProjectConfig();
@@ -74,6 +78,8 @@ CLASS_FIELDS_META(o2::ProjectConfig)
 	FIELD().NAME(projectName).PUBLIC();
 	FIELD().NAME(currentPlatform).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(physics).PUBLIC();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(binaryBuiltAssets).PUBLIC();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(incrementalAtlasRebuild).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mProjectName).PROTECTED();
 	FIELD().NAME(mPlatform).PROTECTED();
 }
@@ -67,6 +67,8 @@ const char* GetBuiltAssetsPath()
 	return "BuiltAssets/Windows/Data/";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/BuiltAssets/";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data/";
 #endif
 }
 
@@ -81,6 +83,8 @@ const char* GetBuiltAssetsTreePath()
 	return "BuiltAssets/Windows/Data.json";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/AssetsTree.json";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data.json";
 #endif
 }
 
@@ -15,6 +15,13 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables 32 bit vertex indexes in meshes and render batches. Allows meshes and batches bigger than 65535 vertices
+#if defined PLATFORM_ANDROID
+#define RENDER_32BIT_INDEXES false
+#else
+#define RENDER_32BIT_INDEXES true
+#endif
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
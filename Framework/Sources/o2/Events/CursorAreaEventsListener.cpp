@@ -25,6 +25,11 @@ namespace o2
 		return false;
 	}
 
+	RectF CursorAreaEventsListener::GetCursorAreaBounds()
+	{
+		return mScissorRect;
+	}
+
 	bool CursorAreaEventsListener::IsScrollable() const
 	{
 		return false;
@@ -36,6 +36,10 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns rectangle, containing all points where IsUnderPoint can be true. It is used to place listener in hit testing grid.
+		// By default it is scissor rect at drawing moment
+		virtual RectF GetCursorAreaBounds();
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
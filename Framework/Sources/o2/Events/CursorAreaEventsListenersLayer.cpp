@@ -1,8 +1,11 @@
 #include "o2/stdafx.h"
 #include "CursorAreaEventsListenersLayer.h"
 
+#include "o2/Application/Application.h"
 #include "o2/Events/EventSystem.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
+#include "o2/Utils/Types/Containers/ArenaVector.h"
 
 namespace o2
 {
@@ -45,9 +48,11 @@ namespace o2
 	void CursorAreaEventListenersLayer::Update()
 	{
 		cursorEventAreaListeners.Reverse();
+		mListenersBounds.Reverse();
 		mDragListeners.Reverse();
+		mHitGridChanged = true;
 
-		mLastUnderCursorListeners = mUnderCursorListeners;
+		mLastUnderCursorListeners.swap(mUnderCursorListeners);
 		mUnderCursorListeners.Clear();
 
 		if (mEnabled)
@@ -102,7 +107,16 @@ namespace o2
 	void CursorAreaEventListenersLayer::PostUpdate()
 	{
 		cursorEventAreaListeners.Clear();
+		mListenersBounds.Clear();
 		mDragListeners.Clear();
+		mHitGridChanged = true;
+	}
+
+	void CursorAreaEventListenersLayer::AddDrawnListener(CursorAreaEventsListener* listener)
+	{
+		cursorEventAreaListeners.Add(listener);
+		mListenersBounds.Add(listener->GetCursorAreaBounds());
+		mHitGridChanged = true;
 	}
 
 	void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -121,7 +135,16 @@ namespace o2
 
 	void CursorAreaEventListenersLayer::UnregCursorAreaListener(CursorAreaEventsListener* listener)
 	{
-		cursorEventAreaListeners.RemoveAll([&](auto x) { return x == listener; });
+		for (int i = cursorEventAreaListeners.Count() - 1; i >= 0; i--)
+		{
+			if (cursorEventAreaListeners[i] == listener)
+			{
+				cursorEventAreaListeners.RemoveAt(i);
+				mListenersBounds.RemoveAt(i);
+				mHitGridChanged = true;
+			}
+		}
+
 		mRightButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 		mMiddleButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 
@@ -145,6 +168,13 @@ namespace o2
 		return cursorEventAreaListeners;
 	}
 
+	Vector<CursorAreaEventsListener*> CursorAreaEventListenersLayer::GetListenersAtPoint(const Vec2F& point) const
+	{
+		Vector<CursorAreaEventsListener*> res;
+		ForEachListenerAtPoint(point, [&](CursorAreaEventsListener* listener) { res.Add(listener); return true; });
+		return res;
+	}
+
 	bool CursorAreaEventListenersLayer::IsUnderPoint(const Vec2F& point)
 	{
 		return drawnTransform.IsPointInside(point);
@@ -173,23 +203,22 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
-		for (auto listener : cursorEventAreaListeners)
+		ForEachListenerAtPoint(localCursor.position, [&](CursorAreaEventsListener* listener)
 		{
 			if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
-				continue;
+				return true;
 
 			auto drag = dynamic_cast<DragableObject*>(listener);
 			if (drag && drag->IsDragging())
-				continue;
+				return true;
 
 			if (!mUnderCursorListeners.ContainsKey(localCursor.id))
 				mUnderCursorListeners.Add(localCursor.id, {});
 
 			mUnderCursorListeners[localCursor.id].Add(listener);
 
-			if (!listener->IsInputTransparent())
-				return;
-		}
+			return listener->IsInputTransparent();
+		});
 	}
 
 	void CursorAreaEventListenersLayer::ProcessCursorEnter()
@@ -318,7 +347,7 @@ namespace o2
 
 		mRightButtonPressedListeners.Clear();
 
-		auto listeners = mUnderCursorListeners[localCursor.id];
+		ArenaVector<CursorAreaEventsListener*> listeners(o2Application.GetFrameAllocator(), mUnderCursorListeners[localCursor.id]);
 		for (auto listener : listeners)
 		{
 			mRightButtonPressedListeners.Add(listener);
@@ -377,7 +406,7 @@ namespace o2
 
 		mMiddleButtonPressedListeners.Clear();
 
-		auto listeners = mUnderCursorListeners[localCursor.id];
+		ArenaVector<CursorAreaEventsListener*> listeners(o2Application.GetFrameAllocator(), mUnderCursorListeners[localCursor.id]);
 		for (auto listener : listeners)
 		{
 			mMiddleButtonPressedListeners.Add(listener);
@@ -447,4 +476,115 @@ namespace o2
 			}
 		}
 	}
+
+	void CursorAreaEventListenersLayer::RebuildHitGrid() const
+	{
+		mHitGridChanged = false;
+		mHitGridSize = Vec2I();
+		mWideListeners.Clear();
+
+		// Grid covers bounded listeners, cell size is close to their median size. Few big listeners, like ones bounded 
+		// by scissor rect, don't affect it and are checked as wide listeners
+		mHitGridWidths.Clear();
+		mHitGridHeights.Clear();
+		for (auto& bounds : mListenersBounds)
+		{
+			if (bounds.Width() > unboundedListenerSize || bounds.Height() > unboundedListenerSize)
+				continue;
+
+			mHitGridArea = mHitGridWidths.IsEmpty() ? bounds : mHitGridArea.Expand(bounds);
+			mHitGridWidths.Add(bounds.Width());
+			mHitGridHeights.Add(bounds.Height());
+		}
+
+		int boundedCount = mHitGridWidths.Count();
+		if (boundedCount > 0)
+		{
+			std::nth_element(mHitGridWidths.begin(), mHitGridWidths.begin() + boundedCount/2, mHitGridWidths.end());
+			std::nth_element(mHitGridHeights.begin(), mHitGridHeights.begin() + boundedCount/2, mHitGridHeights.end());
+
+			Vec2F medianSize(mHitGridWidths[boundedCount/2], mHitGridHeights[boundedCount/2]);
+			mHitGridCellSize.x = Math::Max(Math::Max(medianSize.x, mHitGridArea.Width()/maxHitGridSize), 1.0f);
+			mHitGridCellSize.y = Math::Max(Math::Max(medianSize.y, mHitGridArea.Height()/maxHitGridSize), 1.0f);
+
+			mHitGridSize.x = Math::Clamp(Math::CeilToInt(mHitGridArea.Width()/mHitGridCellSize.x), 1, maxHitGridSize);
+			mHitGridSize.y = Math::Clamp(Math::CeilToInt(mHitGridArea.Height()/mHitGridCellSize.y), 1, maxHitGridSize);
+		}
+
+		// Listener covering much more cells than typical one would be added into many cells, it is checked separately
+		int cellsCount = mHitGridSize.x*mHitGridSize.y;
+		int maxListenerCells = Math::Min(Math::Max(cellsCount/4, 4), 16);
+
+		mHitGridCellStarts.assign(cellsCount + 1, 0);
+
+		// Counting listeners in cells. Listeners covering too many cells are checked separately
+		Vec2I begin, end;
+		for (int i = 0; i < mListenersBounds.Count(); i++)
+		{
+			if (!GetHitGridCellsRange(mListenersBounds[i], begin, end) ||
+				(end.x - begin.x + 1)*(end.y - begin.y + 1) > maxListenerCells)
+			{
+				mWideListeners.Add(i);
+				continue;
+			}
+
+			for (int y = begin.y; y <= end.y; y++)
+			{
+				for (int x = begin.x; x <= end.x; x++)
+					mHitGridCellStarts[y*mHitGridSize.x + x + 1]++;
+			}
+		}
+
+		for (int i = 0; i < cellsCount; i++)
+			mHitGridCellStarts[i + 1] += mHitGridCellStarts[i];
+
+		// Filling cells in listeners order, so each cell stays ascending
+		mHitGridCellsListeners.resize(mHitGridCellStarts[cellsCount]);
+		mHitGridCellsFilling.assign(mHitGridCellStarts.begin(), mHitGridCellStarts.end() - 1);
+
+		int wideIdx = 0;
+		for (int i = 0; i < mListenersBounds.Count(); i++)
+		{
+			if (wideIdx < mWideListeners.Count() && mWideListeners[wideIdx] == i)
+			{
+				wideIdx++;
+				continue;
+			}
+
+			GetHitGridCellsRange(mListenersBounds[i], begin, end);
+
+			for (int y = begin.y; y <= end.y; y++)
+			{
+				for (int x = begin.x; x <= end.x; x++)
+					mHitGridCellsListeners[mHitGridCellsFilling[y*mHitGridSize.x + x]++] = i;
+			}
+		}
+	}
+
+	bool CursorAreaEventListenersLayer::GetHitGridCellsRange(const RectF& rect, Vec2I& begin, Vec2I& end) const
+	{
+		if (mHitGridSize.x == 0 || rect.Width() > unboundedListenerSize || rect.Height() > unboundedListenerSize)
+			return false;
+
+		begin.x = Math::Clamp(Math::FloorToInt((rect.left - mHitGridArea.left)/mHitGridCellSize.x), 0, mHitGridSize.x - 1);
+		begin.y = Math::Clamp(Math::FloorToInt((rect.bottom - mHitGridArea.bottom)/mHitGridCellSize.y), 0, mHitGridSize.y - 1);
+		end.x = Math::Clamp(Math::FloorToInt((rect.right - mHitGridArea.left)/mHitGridCellSize.x), 0, mHitGridSize.x - 1);
+		end.y = Math::Clamp(Math::FloorToInt((rect.top - mHitGridArea.bottom)/mHitGridCellSize.y), 0, mHitGridSize.y - 1);
+
+		return true;
+	}
+
+	int CursorAreaEventListenersLayer::GetHitGridCell(const Vec2F& point) const
+	{
+		if (mHitGridSize.x == 0 || point.x < mHitGridArea.left || point.x > mHitGridArea.right ||
+			point.y < mHitGridArea.bottom || point.y > mHitGridArea.top)
+		{
+			return -1;
+		}
+
+		int x = Math::Min(Math::FloorToInt((point.x - mHitGridArea.left)/mHitGridCellSize.x), mHitGridSize.x - 1);
+		int y = Math::Min(Math::FloorToInt((point.y - mHitGridArea.bottom)/mHitGridCellSize.y), mHitGridSize.y - 1);
+
+		return y*mHitGridSize.x + x;
+	}
 }
\ No newline at end of file
@@ -43,6 +43,9 @@ namespace o2
 		// Post update events
 		void PostUpdate();
 
+		// Adds drawn listener with its bounds at drawing moment. Listeners are hit tested in reversed drawing order
+		void AddDrawnListener(CursorAreaEventsListener* listener);
+
 		// Breaks cursor event. All pressed listeners will be unpressed with specific event OnPressBreak
 		void BreakCursorEvent();
 
@@ -55,6 +58,9 @@ namespace o2
 		// Returns all cursor listeners under cursor arranged by depth
 		Vector<CursorAreaEventsListener*> GetAllCursorListenersUnderCursor(CursorId cursorId) const;
 
+		// Returns listeners, which bounds at drawing moment contain local point, in hit testing order
+		Vector<CursorAreaEventsListener*> GetListenersAtPoint(const Vec2F& point) const;
+
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
@@ -72,6 +78,23 @@ namespace o2
 
 		Vector<DragableObject*> mDragListeners; // Drag events listeners
 
+		static constexpr int   maxHitGridSize = 64;           // Maximum count of hit testing grid cells by each axis
+		static constexpr float unboundedListenerSize = 1e6f; // Listeners with bigger bounds aren't placed into grid cells
+
+		Vector<RectF> mListenersBounds;       // Listeners bounds at drawing moment, same order as cursorEventAreaListeners
+		mutable bool mHitGridChanged = true; // True when listeners were changed and hit testing grid must be rebuilt
+
+		mutable RectF       mHitGridArea;           // Area covered by hit testing grid
+		mutable Vec2F       mHitGridCellSize;       // Size of hit testing grid cell
+		mutable Vec2I       mHitGridSize;           // Count of hit testing grid cells by axes
+		mutable Vector<int> mHitGridCellStarts;     // Beginning of each cell in mHitGridCellsListeners, last one is total count
+		mutable Vector<int> mHitGridCellsFilling;   // Filling positions of cells, used when building grid
+		mutable Vector<int> mHitGridCellsListeners; // Listeners indices of all cells, ascending in each cell
+		mutable Vector<int> mWideListeners;         // Ascending indices of listeners, covering too many cells. They are checked for any point
+
+		mutable Vector<float> mHitGridWidths;  // Bounded listeners widths buffer, used for median cell size calculation
+		mutable Vector<float> mHitGridHeights; // Bounded listeners heights buffer, used for median cell size calculation
+
 	private:
 		// It is called when cursor enters this object
 		void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -121,6 +144,49 @@ namespace o2
 		// Processes scrolling event
 		void ProcessScrolling();
 
+		// Rebuilds hit testing grid by listeners bounds
+		void RebuildHitGrid() const;
+
+		// Returns hit testing grid cells range, covering rectangle. Returns false when rectangle is out of grid
+		bool GetHitGridCellsRange(const RectF& rect, Vec2I& begin, Vec2I& end) const;
+
+		// Returns hit testing grid cell index by point, -1 when point is out of grid
+		int GetHitGridCell(const Vec2F& point) const;
+
+		// Calls callback(CursorAreaEventsListener*) for listeners, which bounds contain point, in listeners order. 
+		// Stops when callback returns false
+		template<typename _callback>
+		void ForEachListenerAtPoint(const Vec2F& point, _callback callback) const;
+
 		friend class EventSystem;
 	};
+
+	template<typename _callback>
+	void CursorAreaEventListenersLayer::ForEachListenerAtPoint(const Vec2F& point, _callback callback) const
+	{
+		if (mHitGridChanged)
+			RebuildHitGrid();
+
+		int cell = GetHitGridCell(point);
+		int cellIdx = cell < 0 ? 0 : mHitGridCellStarts[cell];
+		int cellEnd = cell < 0 ? 0 : mHitGridCellStarts[cell + 1];
+		int wideIdx = 0, wideEnd = mWideListeners.Count();
+
+		// Cell and wide listeners are both ascending, merging them keeps listeners order
+		while (cellIdx < cellEnd || wideIdx < wideEnd)
+		{
+			int index;
+			if (wideIdx == wideEnd || (cellIdx < cellEnd && mHitGridCellsListeners[cellIdx] < mWideListeners[wideIdx]))
+				index = mHitGridCellsListeners[cellIdx++];
+			else
+				index = mWideListeners[wideIdx++];
+
+			const RectF& bounds = mListenersBounds[index];
+			if (point.x < bounds.left || point.x > bounds.right || point.y < bounds.bottom || point.y > bounds.top)
+				continue;
+
+			if (!callback(cursorEventAreaListeners[index]))
+				return;
+		}
+	}
 }
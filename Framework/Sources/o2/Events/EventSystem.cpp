@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "EventSystem.h"
 
+#include "o2/Application/Application.h"
 #include "o2/Events/ApplicationEventsListener.h"
 #include "o2/Events/CursorAreaEventsListener.h"
 #include "o2/Events/KeyboardEventsListener.h"
@@ -11,7 +12,9 @@
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
 #include "o2/Utils/Editor/EditorScope.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
+#include "o2/Utils/Types/Containers/ArenaVector.h"
 
 namespace o2
 {
@@ -214,13 +217,13 @@ namespace o2
 	{
 		Vector<CursorAreaEventsListener*> res;
 		Vec2F cursorPos = o2Input.GetCursorPos(cursorId);
-		for (auto listener : mCursorAreaListenersBasicLayer.cursorEventAreaListeners)
+		mCursorAreaListenersBasicLayer.ForEachListenerAtPoint(cursorPos, [&](CursorAreaEventsListener* listener)
 		{
-			if (!listener->IsUnderPoint(cursorPos) || !listener->mScissorRect.IsInside(cursorPos) || !listener->mInteractable)
-				continue;
+			if (listener->IsUnderPoint(cursorPos) && listener->mScissorRect.IsInside(cursorPos) && listener->mInteractable)
+				res.Add(listener);
 
-			res.Add(listener);
-		}
+			return true;
+		});
 
 		return res;
 	}
@@ -233,7 +236,7 @@ namespace o2
 
 	void EventSystem::ProcessKeyPressed(const Input::Key& key)
 	{
-		auto listeners = mKeyboardListeners;
+		ArenaVector<KeyboardEventsListener*> listeners(o2Application.GetFrameAllocator(), mKeyboardListeners);
 		for (auto listener : listeners)
 		{
 			if (listener->mEnabledListeningEvents)
@@ -243,7 +246,7 @@ namespace o2
 
 	void EventSystem::ProcessKeyDown(const Input::Key& key)
 	{
-		auto listeners = mKeyboardListeners;
+		ArenaVector<KeyboardEventsListener*> listeners(o2Application.GetFrameAllocator(), mKeyboardListeners);
 		for (auto listener : listeners)
 		{
 			if (listener->mEnabledListeningEvents)
@@ -253,7 +256,7 @@ namespace o2
 
 	void EventSystem::ProcessKeyReleased(const Input::Key& key)
 	{
-		auto listeners = mKeyboardListeners;
+		ArenaVector<KeyboardEventsListener*> listeners(o2Application.GetFrameAllocator(), mKeyboardListeners);
 		for (auto listener : listeners)
 		{
 			if (listener->mEnabledListeningEvents)
@@ -285,7 +288,7 @@ namespace o2
 		if (!listener->IsListeningEvents())
 			return;
 
-		mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
+		mInstance->mCurrentCursorAreaEventsLayer->AddDrawnListener(listener);
 	}
 
 	void EventSystem::UnregCursorAreaListener(CursorAreaEventsListener* listener)
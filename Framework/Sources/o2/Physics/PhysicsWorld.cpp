@@ -1,15 +1,87 @@
 #include "o2/stdafx.h"
 #include "PhysicsWorld.h"
 
+#include "Box2D/Collision/Shapes/b2CircleShape.h"
+#include "Box2D/Collision/b2Collision.h"
+#include "Box2D/Collision/b2Distance.h"
+#include "Box2D/Collision/b2TimeOfImpact.h"
 #include "Box2D/Dynamics/b2Body.h"
+#include "Box2D/Dynamics/b2Fixture.h"
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Scene/Physics/ICollider.h"
 #include "o2/Scene/Physics/RigidBody.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 namespace o2
 {
 	DECLARE_SINGLETON(PhysicsWorld);
 
+	// Ray cast callback, clips ray by each hit and keeps closest fixture
+	class ClosestRayCastCallback: public b2RayCastCallback
+	{
+	public:
+		bool       includeSensors = false;
+		b2Fixture* fixture = nullptr;
+		b2Vec2     point;
+		b2Vec2     normal;
+		float32    fraction = 1.0f;
+
+	public:
+		float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override
+		{
+			if (!includeSensors && fixture->IsSensor())
+				return -1.0f;
+
+			this->fixture = fixture;
+			this->point = point;
+			this->normal = normal;
+			this->fraction = fraction;
+
+			return fraction;
+		}
+	};
+
+	// Ray cast callback, collects all hits without clipping ray
+	class AllRayCastCallback: public b2RayCastCallback
+	{
+	public:
+		struct Hit
+		{
+			b2Fixture* fixture;
+			b2Vec2     point;
+			b2Vec2     normal;
+			float32    fraction;
+		};
+
+	public:
+		bool        includeSensors = false;
+		Vector<Hit> hits;
+
+	public:
+		float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override
+		{
+			if (!includeSensors && fixture->IsSensor())
+				return -1.0f;
+
+			hits.Add({ fixture, point, normal, fraction });
+			return 1.0f;
+		}
+	};
+
+	// AABB query callback, collects fixtures
+	class FixturesQueryCallback: public b2QueryCallback
+	{
+	public:
+		Vector<b2Fixture*> fixtures;
+
+	public:
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			fixtures.Add(fixture);
+			return true;
+		}
+	};
+
 	PhysicsWorld::PhysicsWorld():
 		mWorld(Vec2F())
 	{
@@ -30,13 +102,47 @@ namespace o2
 
 		float invScale = 1.0f/o2Config.physics.scale;
 
-		for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
+		// Setting transform resets body contacts, so only bodies moved outside physics are synchronized
+		for (auto rigidBody : mChangedBodies)
 		{
-			auto rigidBody = (RigidBody*)body->GetUserData();
-			auto transform = rigidBody->transform;
+			rigidBody->mTransformChanged = false;
 
-			body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
+			b2Body* body = rigidBody->mBody;
+			if (!body)
+				continue;
+
+			// Transform can be changed and not updated yet, world basis getter updates it
+			Vec2F actorPosition = rigidBody->transform->GetWorldPosition();
+			float actorAngle = rigidBody->transform->GetWorldBasis().GetAngle();
+
+			Vec2F position = actorPosition;
+			float angle = actorAngle;
+
+			// Actor of interpolated body shows pose between physics steps, which is behind or ahead of body. Only user
+			// change is applied to body, otherwise it would be pushed back to shown pose
+			if (rigidBody->mIsInterpolated)
+			{
+				position = rigidBody->mPhysicsPosition + (actorPosition - rigidBody->mSyncedPosition);
+				const double fullTurn = 6.283185307179586;
+				angle = rigidBody->mPhysicsAngle + (float)std::remainder((double)actorAngle - rigidBody->mSyncedAngle, fullTurn);
+			}
+
+			body->SetTransform(position*invScale, angle);
+
+			if (body->GetType() != b2_staticBody)
+				body->SetAwake(true);
+
+			rigidBody->mSyncedPosition = actorPosition;
+			rigidBody->mSyncedAngle = actorAngle;
+
+			// Teleported body isn't interpolated from previous position
+			rigidBody->mPhysicsPosition = position;
+			rigidBody->mPhysicsAngle = angle;
+			rigidBody->mPrevPhysicsPosition = position;
+			rigidBody->mPrevPhysicsAngle = angle;
 		}
+
+		mChangedBodies.Clear();
 	}
 
 	void PhysicsWorld::Update(float dt)
@@ -47,18 +153,79 @@ namespace o2
 	void PhysicsWorld::PostUpdate()
 	{
 		float scale = o2Config.physics.scale;
+		bool interpolation = o2Config.physics.interpolation != PhysicsConfig::InterpolationMode::None;
+
+		for (auto rigidBody : mInterpolatedBodies)
+			rigidBody->mIsInterpolated = false;
+
+		mInterpolatedBodies.Clear();
+
 		for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
 		{
+			if (body->GetType() == b2_staticBody)
+				continue;
+
 			auto rigidBody = (RigidBody*)body->GetUserData();
-			auto transform = rigidBody->transform;
 
-			transform->SetWorldPosition(Vec2F(body->GetPosition())*scale);
-			transform->SetWorldAngle(body->GetAngle());
+			// Body falls asleep at the end of step, so it is synchronized last time in the step it fell asleep.
+			// Interpolated body is synchronized once more, until its previous and current states become equal
+			bool isAwake = body->IsAwake();
+			bool wasAwake = rigidBody->mWasAwake;
+			rigidBody->mWasAwake = isAwake;
+
+			if (!isAwake && !wasAwake && !(interpolation && rigidBody->mIsMoving))
+			{
+				rigidBody->mIsMoving = false;
+				continue;
+			}
+
+			Vec2F position = Vec2F(body->GetPosition())*scale;
+			float angle = body->GetAngle();
+
+			rigidBody->mPrevPhysicsPosition = rigidBody->mPhysicsPosition;
+			rigidBody->mPrevPhysicsAngle = rigidBody->mPhysicsAngle;
+			rigidBody->mPhysicsPosition = position;
+			rigidBody->mPhysicsAngle = angle;
+			rigidBody->mIsMoving = isAwake || rigidBody->mPrevPhysicsPosition != position || rigidBody->mPrevPhysicsAngle != angle;
+
+			if (interpolation)
+			{
+				rigidBody->mIsInterpolated = true;
+				mInterpolatedBodies.Add(rigidBody);
+			}
+			else
+				SetBodyActorTransform(rigidBody, position, angle);
 		}
 
 		mIsUpdatingPhysicsNow = false;
 	}
 
+	void PhysicsWorld::Interpolate(float alpha)
+	{
+		auto mode = o2Config.physics.interpolation;
+		if (mode == PhysicsConfig::InterpolationMode::None)
+			return;
+
+		// Interpolation shows state between two last steps, extrapolation continues last step motion
+		float coef = mode == PhysicsConfig::InterpolationMode::Interpolate ? alpha - 1.0f : alpha;
+
+		mIsInterpolatingNow = true;
+
+		for (auto rigidBody : mInterpolatedBodies)
+		{
+			// Body moved outside physics is pushed to physics in next PreUpdate, interpolation must not override it
+			if (rigidBody->mTransformChanged)
+				continue;
+
+			Vec2F position = rigidBody->mPhysicsPosition + (rigidBody->mPhysicsPosition - rigidBody->mPrevPhysicsPosition)*coef;
+			float angle = rigidBody->mPhysicsAngle + (rigidBody->mPhysicsAngle - rigidBody->mPrevPhysicsAngle)*coef;
+
+			SetBodyActorTransform(rigidBody, position, angle);
+		}
+
+		mIsInterpolatingNow = false;
+	}
+
 	void PhysicsWorld::DrawDebug()
 	{
 		mWorld.DrawDebugData();
@@ -69,6 +236,263 @@ namespace o2
 		return mIsUpdatingPhysicsNow;
 	}
 
+	bool PhysicsWorld::IsInterpolatingNow() const
+	{
+		return mIsInterpolatingNow;
+	}
+
+	bool PhysicsWorld::IsSyncingTransformsNow() const
+	{
+		return mIsUpdatingPhysicsNow || mIsInterpolatingNow;
+	}
+
+	bool PhysicsWorld::RayCast(const Vec2F& from, const Vec2F& to, RayCastHit& hit, bool includeSensors /*= false*/) const
+	{
+		hit = RayCastHit();
+
+		if (from == to)
+			return false;
+
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		ClosestRayCastCallback callback;
+		callback.includeSensors = includeSensors;
+		mWorld.RayCast(&callback, from*invScale, to*invScale);
+
+		if (!callback.fixture)
+			return false;
+
+		FillRayCastHit(hit, callback.fixture, callback.point, callback.normal, callback.fraction, from, to);
+		return true;
+	}
+
+	Vector<PhysicsWorld::RayCastHit> PhysicsWorld::RayCastAll(const Vec2F& from, const Vec2F& to, 
+															  bool includeSensors /*= false*/) const
+	{
+		if (from == to)
+			return Vector<RayCastHit>();
+
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		AllRayCastCallback callback;
+		callback.includeSensors = includeSensors;
+		mWorld.RayCast(&callback, from*invScale, to*invScale);
+
+		Vector<RayCastHit> res;
+		res.Resize(callback.hits.Count());
+		for (int i = 0; i < callback.hits.Count(); i++)
+		{
+			auto& hit = callback.hits[i];
+			FillRayCastHit(res[i], hit.fixture, hit.point, hit.normal, hit.fraction, from, to);
+		}
+
+		// Box2D reports hits in broadphase order
+		std::sort(res.begin(), res.end(), [](const RayCastHit& a, const RayCastHit& b) { return a.fraction < b.fraction; });
+
+		return res;
+	}
+
+	void PhysicsWorld::RayCastBatch(const Vector<Ray>& rays, Vector<RayCastHit>& results, bool parallel /*= true*/, 
+									bool includeSensors /*= false*/) const
+	{
+		const int raysBatchSize = 64;
+
+		results.Resize(rays.Count());
+
+		// Box2D queries only read broadphase tree and fixtures, so rays can be cast concurrently while world isn't stepping
+		auto castRay = [&](int idx) { RayCast(rays[idx].from, rays[idx].to, results[idx], includeSensors); };
+
+		if (parallel && rays.Count() > raysBatchSize && JobSystem::IsSingletonInitialzed())
+			o2Jobs.ParallelFor(rays.Count(), castRay, raysBatchSize);
+		else
+		{
+			for (int i = 0; i < rays.Count(); i++)
+				castRay(i);
+		}
+	}
+
+	bool PhysicsWorld::CircleCast(const Vec2F& from, const Vec2F& to, float radius, RayCastHit& hit, 
+								  bool includeSensors /*= false*/) const
+	{
+		hit = RayCastHit();
+
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		b2Vec2 physicsFrom = from*invScale;
+		b2Vec2 physicsTo = to*invScale;
+
+		b2CircleShape circle;
+		circle.m_p.SetZero();
+		circle.m_radius = radius*invScale;
+
+		// Candidates are fixtures in circle swept bounding box
+		b2AABB aabb;
+		aabb.lowerBound = b2Min(physicsFrom, physicsTo) - b2Vec2(circle.m_radius, circle.m_radius);
+		aabb.upperBound = b2Max(physicsFrom, physicsTo) + b2Vec2(circle.m_radius, circle.m_radius);
+
+		FixturesQueryCallback callback;
+		mWorld.QueryAABB(&callback, aabb);
+
+		b2Sweep circleSweep;
+		circleSweep.localCenter.SetZero();
+		circleSweep.c0 = physicsFrom;
+		circleSweep.c = physicsTo;
+		circleSweep.a0 = circleSweep.a = 0.0f;
+		circleSweep.alpha0 = 0.0f;
+
+		b2Fixture* closestFixture = nullptr;
+		int closestChild = 0;
+		float closestFraction = 1.0f;
+		bool closestOverlapped = false;
+
+		for (auto fixture : callback.fixtures)
+		{
+			if (!includeSensors && fixture->IsSensor())
+				continue;
+
+			b2Shape* shape = fixture->GetShape();
+			const b2Transform& bodyTransform = fixture->GetBody()->GetTransform();
+
+			// Colliders don't move while casting, so their sweeps are constant
+			b2Sweep fixtureSweep;
+			fixtureSweep.localCenter.SetZero();
+			fixtureSweep.c0 = fixtureSweep.c = bodyTransform.p;
+			fixtureSweep.a0 = fixtureSweep.a = bodyTransform.q.GetAngle();
+			fixtureSweep.alpha0 = 0.0f;
+
+			for (int i = 0; i < shape->GetChildCount(); i++)
+			{
+				b2TOIInput input;
+				input.proxyA.Set(shape, i);
+				input.proxyB.Set(&circle, 0);
+				input.sweepA = fixtureSweep;
+				input.sweepB = circleSweep;
+				input.tMax = 1.0f;
+
+				b2TOIOutput output;
+				b2TimeOfImpact(&output, &input);
+
+				if (output.state != b2TOIOutput::e_touching && output.state != b2TOIOutput::e_overlapped)
+					continue;
+
+				float fraction = output.state == b2TOIOutput::e_overlapped ? 0.0f : output.t;
+				if (closestFixture && fraction >= closestFraction)
+					continue;
+
+				closestFixture = fixture;
+				closestChild = i;
+				closestFraction = fraction;
+				closestOverlapped = output.state == b2TOIOutput::e_overlapped;
+			}
+		}
+
+		if (!closestFixture)
+			return false;
+
+		// Contact point and normal are closest features of shapes at time of impact
+		b2Vec2 circleCenter = physicsFrom + closestFraction*(physicsTo - physicsFrom);
+		b2Vec2 castDirection = physicsTo - physicsFrom;
+		castDirection.Normalize();
+
+		b2DistanceInput distanceInput;
+		distanceInput.proxyA.Set(closestFixture->GetShape(), closestChild);
+		distanceInput.proxyB.Set(&circle, 0);
+		distanceInput.transformA = closestFixture->GetBody()->GetTransform();
+		distanceInput.transformB.Set(circleCenter, 0.0f);
+		distanceInput.useRadii = false;
+
+		b2SimplexCache cache;
+		cache.count = 0;
+
+		b2DistanceOutput distanceOutput;
+		b2Distance(&distanceOutput, &cache, &distanceInput);
+
+		b2Vec2 normal = distanceOutput.pointB - distanceOutput.pointA;
+		if (closestOverlapped || normal.Normalize() < b2_epsilon)
+			normal = -castDirection;
+
+		b2Vec2 point = distanceOutput.pointA + distanceInput.proxyA.m_radius*normal;
+
+		FillRayCastHit(hit, closestFixture, point, normal, closestFraction, from, to);
+		return true;
+	}
+
+	Vector<ICollider*> PhysicsWorld::OverlapAABB(const RectF& rect, bool includeSensors /*= false*/) const
+	{
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		b2AABB aabb;
+		aabb.lowerBound = Vec2F(rect.left, rect.bottom)*invScale;
+		aabb.upperBound = Vec2F(rect.right, rect.top)*invScale;
+
+		FixturesQueryCallback callback;
+		mWorld.QueryAABB(&callback, aabb);
+
+		// Broadphase reports fattened proxies, so fixtures bounding boxes are tested again
+		Vector<ICollider*> res;
+		for (auto fixture : callback.fixtures)
+		{
+			if (!includeSensors && fixture->IsSensor())
+				continue;
+
+			for (int i = 0; i < fixture->GetShape()->GetChildCount(); i++)
+			{
+				if (b2TestOverlap(fixture->GetAABB(i), aabb))
+				{
+					auto collider = (ICollider*)fixture->GetUserData();
+					if (!res.Contains(collider))
+						res.Add(collider);
+
+					break;
+				}
+			}
+		}
+
+		return res;
+	}
+
+	Vector<ICollider*> PhysicsWorld::OverlapCircle(const Vec2F& center, float radius, bool includeSensors /*= false*/) const
+	{
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		b2CircleShape circle;
+		circle.m_p = center*invScale;
+		circle.m_radius = radius*invScale;
+
+		b2Transform circleTransform;
+		circleTransform.SetIdentity();
+
+		b2AABB aabb;
+		circle.ComputeAABB(&aabb, circleTransform, 0);
+
+		FixturesQueryCallback callback;
+		mWorld.QueryAABB(&callback, aabb);
+
+		Vector<ICollider*> res;
+		for (auto fixture : callback.fixtures)
+		{
+			if (!includeSensors && fixture->IsSensor())
+				continue;
+
+			b2Shape* shape = fixture->GetShape();
+			const b2Transform& bodyTransform = fixture->GetBody()->GetTransform();
+
+			for (int i = 0; i < shape->GetChildCount(); i++)
+			{
+				if (b2TestOverlap(shape, i, &circle, 0, bodyTransform, circleTransform))
+				{
+					auto collider = (ICollider*)fixture->GetUserData();
+					if (!res.Contains(collider))
+						res.Add(collider);
+
+					break;
+				}
+			}
+		}
+
+		return res;
+	}
+
 	void PhysicsWorld::CheckPhysicsScale()
 	{
 		if (Math::Equals(mPrevPhysicsScale, o2Config.physics.scale))
@@ -83,6 +507,11 @@ namespace o2
 
 			body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
 
+			rigidBody->mSyncedPosition = transform->GetWorldPosition();
+			rigidBody->mSyncedAngle = transform->GetWorldAngle();
+			rigidBody->mPhysicsPosition = rigidBody->mPrevPhysicsPosition = rigidBody->mSyncedPosition;
+			rigidBody->mPhysicsAngle = rigidBody->mPrevPhysicsAngle = rigidBody->mSyncedAngle;
+
 			auto colliders = rigidBody->mColliders;
 			for (auto collider : colliders)
 				collider->OnShapeChanged();
@@ -91,6 +520,52 @@ namespace o2
 		mPrevPhysicsScale = scale;
 	}
 
+	void PhysicsWorld::OnBodyTransformChanged(RigidBody* body)
+	{
+		if (body->mTransformChanged)
+			return;
+
+		body->mTransformChanged = true;
+		mChangedBodies.Add(body);
+	}
+
+	void PhysicsWorld::OnBodyRemoved(RigidBody* body)
+	{
+		if (body->mTransformChanged)
+		{
+			body->mTransformChanged = false;
+			mChangedBodies.Remove(body);
+		}
+
+		if (body->mIsInterpolated)
+		{
+			body->mIsInterpolated = false;
+			mInterpolatedBodies.Remove(body);
+		}
+	}
+
+	void PhysicsWorld::SetBodyActorTransform(RigidBody* body, const Vec2F& position, float angle)
+	{
+		body->transform->SetWorldPosition(position);
+		body->transform->SetWorldAngle(angle);
+
+		// World position is converted through parents transforms, so it is read back to compare exactly with value,
+		// that transform returns later. World angle getter is actual only after transform update, so written angle is stored
+		body->mSyncedPosition = body->transform->GetWorldPosition();
+		body->mSyncedAngle = angle;
+	}
+
+	void PhysicsWorld::FillRayCastHit(RayCastHit& hit, b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, 
+									  float fraction, const Vec2F& from, const Vec2F& to)
+	{
+		hit.collider = (ICollider*)fixture->GetUserData();
+		hit.body = (RigidBody*)fixture->GetBody()->GetUserData();
+		hit.point = Vec2F(point)*o2Config.physics.scale;
+		hit.normal = normal;
+		hit.fraction = fraction;
+		hit.distance = (to - from).Length()*fraction;
+	}
+
 	void PhysicsDebugDraw::DrawCircle(const b2Vec2& center, float32 radius, const b2Color& color)
 	{
 		float scale = o2Config.physics.scale;
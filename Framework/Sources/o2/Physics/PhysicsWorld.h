@@ -1,6 +1,9 @@
 #pragma once
 
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
 #include "Box2D/Dynamics/b2World.h"
 #include "Box2D/Common/b2Draw.h"
 
@@ -9,41 +12,125 @@
 
 namespace o2
 {
+	class ICollider;
+	class RigidBody;
+
 	// -------------------
 	// Box2D Physics world
 	// -------------------
 	class PhysicsWorld : public Singleton<PhysicsWorld>
 	{
+	public:
+		// --------------------------------------
+		// Ray between two points in world space
+		// --------------------------------------
+		struct Ray
+		{
+			Vec2F from; // Ray beginning
+			Vec2F to;   // Ray end
+
+			// Default constructor
+			Ray() {}
+
+			// Constructor by points
+			Ray(const Vec2F& from, const Vec2F& to): from(from), to(to) {}
+		};
+
+		// -----------------------------------------------------
+		// Ray cast hit. Collider is null when nothing was hit
+		// -----------------------------------------------------
+		struct RayCastHit
+		{
+			ICollider* collider = nullptr; // Hit collider
+			RigidBody* body = nullptr;     // Rigid body of hit collider
+			Vec2F      point;              // Hit point in world space
+			Vec2F      normal;             // Surface normal at hit point
+			float      fraction = 1.0f;    // Fraction of ray length to hit point
+			float      distance = 0.0f;    // Distance from ray beginning to hit point in world space
+
+			// Returns true when something was hit
+			bool IsHit() const { return collider != nullptr; }
+		};
+
 	public:
 		// Default constructor
 		PhysicsWorld();
 
-		// Synchronize physics bodies with actors
+		// Synchronize physics bodies with actors, which transforms were changed outside physics
 		void PreUpdate();
 
 		// Updates physics world and sync bodies
 		void Update(float dt);
 
-		// Synchronize actors with bodies
+		// Synchronize actors with awake bodies. When interpolation is enabled, only stores bodies states for Interpolate()
 		void PostUpdate();
 
+		// Sets interpolated or extrapolated bodies states to actors by config interpolation mode. Alpha is part of fixed
+		// step, passed since last physics step
+		void Interpolate(float alpha);
+
 		// Draws debug graphics
 		void DrawDebug();
 
 		// Returns True when PreUpdate has just called, until PostUpdate finished
 		bool IsUpdatingPhysicsNow() const;
 
+		// Returns True when Interpolate sets bodies states to actors
+		bool IsInterpolatingNow() const;
+
+		// Returns True when actors transforms are changed by physics: in physics update or interpolation
+		bool IsSyncingTransformsNow() const;
+
+		// Casts ray and returns closest hit. Returns false when nothing was hit. Points are in world space
+		bool RayCast(const Vec2F& from, const Vec2F& to, RayCastHit& hit, bool includeSensors = false) const;
+
+		// Casts ray and returns all hits, sorted by distance
+		Vector<RayCastHit> RayCastAll(const Vec2F& from, const Vec2F& to, bool includeSensors = false) const;
+
+		// Casts rays and puts closest hit of each ray into results at same index. Rays are cast on job system
+		// threads when parallel is true. World must not be changed until it returns
+		void RayCastBatch(const Vector<Ray>& rays, Vector<RayCastHit>& results, bool parallel = true,
+						  bool includeSensors = false) const;
+
+		// Sweeps circle with radius from one point to another and returns closest hit. Returns false when nothing was 
+		// hit. Hit point is contact point on collider surface, normal points from collider to circle. When circle 
+		// overlaps collider at beginning, hit fraction is zero
+		bool CircleCast(const Vec2F& from, const Vec2F& to, float radius, RayCastHit& hit, bool includeSensors = false) const;
+
+		// Returns colliders, which bounding boxes intersect rectangle
+		Vector<ICollider*> OverlapAABB(const RectF& rect, bool includeSensors = false) const;
+
+		// Returns colliders, which shapes intersect circle
+		Vector<ICollider*> OverlapCircle(const Vec2F& center, float radius, bool includeSensors = false) const;
+
 	private:
 		b2World mWorld;
 
 		bool mIsUpdatingPhysicsNow = false; // True when PreUpdate has just called, until PostUpdate finished
+		bool mIsInterpolatingNow = false;   // True when Interpolate sets bodies states to actors
 
 		float mPrevPhysicsScale = 0.0f; // Previous physics scale
 
+		Vector<RigidBody*> mChangedBodies;      // Bodies, which actors transforms were changed outside physics. They are pushed to physics in PreUpdate
+		Vector<RigidBody*> mInterpolatedBodies; // Bodies, moved in last physics step, their transforms are interpolated
+
 	private:
 		// Checks phsyics scale config; updates bodies and colliders with new scale
 		void CheckPhysicsScale();
 
+		// It is called when body actor transform was changed outside physics, body will be synchronized in PreUpdate
+		void OnBodyTransformChanged(RigidBody* body);
+
+		// It is called when body is removed, removes it from changed and interpolated bodies
+		void OnBodyRemoved(RigidBody* body);
+
+		// Sets actor transform of body outside of physics changes tracking
+		void SetBodyActorTransform(RigidBody* body, const Vec2F& position, float angle);
+
+		// Fills hit by fixture and physics space hit point and normal
+		static void FillRayCastHit(RayCastHit& hit, b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, 
+								   float fraction, const Vec2F& from, const Vec2F& to);
+
 		friend class RigidBody;
 	}; 
 	
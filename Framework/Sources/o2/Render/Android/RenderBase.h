@@ -3,6 +3,7 @@
 #ifdef PLATFORM_ANDROID
 
 #include "Render/Android/OpenGL.h"
+#include "Utils/Math/Vertex2.h"
 
 namespace o2
 {
@@ -20,7 +21,7 @@ namespace o2
 		GLuint   mIndexBufferObject;              // Batch polygons indexes buffer
 
 		UInt8*   mVertexData = nullptr;           // Vertex data buffer
-		UInt16*  mVertexIndexData = nullptr;      // Index data buffer
+		VertexIndex* mVertexIndexData = nullptr;  // Index data buffer
 		UInt     mVertexBufferSize;               // Maximum size of vertex buffer
 		UInt     mIndexBufferSize;                // Maximum size of index buffer
 
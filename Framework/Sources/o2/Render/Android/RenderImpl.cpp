@@ -8,6 +8,7 @@
 #include "Assets/Assets.h"
 #include "Render/Font.h"
 #include "Render/Mesh.h"
+#include "Render/QuadInstance.h"
 #include "Render/Sprite.h"
 #include "Render/Texture.h"
 #include "Utils/Debug/Debug.h"
@@ -21,8 +22,11 @@ namespace o2
 	Render::Render() :
 		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
 	{
-		mVertexBufferSize = USHRT_MAX;
-		mIndexBufferSize = USHRT_MAX;
+		mVertexBufferSize = mDefaultBatchVerticesCapacity;
+		mIndexBufferSize = mDefaultBatchIndexesCapacity;
+
+		mTextureSwitchesCount = 0;
+		mScissorChangesCount = 0;
 
 		mLog = mnew LogStream("Render");
 		o2Debug.GetLog()->BindStream(mLog);
@@ -32,7 +36,7 @@ namespace o2
 		CheckCompatibles();
 
 		mVertexData = mnew UInt8[mVertexBufferSize * sizeof(Vertex2)];
-		mVertexIndexData = mnew UInt16[mIndexBufferSize * sizeof(UInt16)];
+		mVertexIndexData = mnew VertexIndex[mIndexBufferSize];
 		
 		glEnable(GL_BLEND);
 		glDisable(GL_DEPTH_TEST);
@@ -48,7 +52,7 @@ namespace o2
 
 		glGenBuffers(1, &mIndexBufferObject);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(mIndexBufferSize * sizeof(UInt16)), mVertexIndexData, GL_DYNAMIC_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(mIndexBufferSize * sizeof(VertexIndex)), mVertexIndexData, GL_DYNAMIC_DRAW);
 
 		//glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
 
@@ -64,6 +68,7 @@ namespace o2
 
 		InitializeFreeType();
 		InitializeLinesIndexBuffer();
+		InitializeQuadsIndexBuffer();
 		InitializeLinesTextures();
 
 		mCurrentRenderTarget = TextureRef();
@@ -228,6 +233,17 @@ namespace o2
         GL_CHECK_ERROR();
 	}
 
+	void Render::OnBatchCapacityChanged()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mVertexBufferSize * sizeof(Vertex2), NULL, GL_DYNAMIC_DRAW);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(mIndexBufferSize * sizeof(VertexIndex)), NULL, GL_DYNAMIC_DRAW);
+
+		GL_CHECK_ERROR();
+	}
+
 	void Render::CheckCompatibles()
 	{
 		//get max texture size
@@ -246,6 +262,9 @@ namespace o2
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mTextureSwitchesCount = 0;
+		mScissorChangesCount = 0;
+		mSortingSavedDIPsCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -266,15 +285,18 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		SubmitSortedDraws();
+
 		if (mLastDrawVertex < 1)
 			return;
 
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
         glBufferData(GL_ARRAY_BUFFER, mLastDrawVertex * sizeof(Vertex2), mVertexData, GL_DYNAMIC_DRAW);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(mLastDrawIdx * sizeof(UInt16)), mVertexIndexData, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(mLastDrawIdx * sizeof(VertexIndex)), mVertexIndexData, GL_DYNAMIC_DRAW);
 
-		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, (void*)0);
+		const GLenum indexType = RENDER_32BIT_INDEXES ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, indexType, (void*)0);
 
 		GL_CHECK_ERROR();
 
@@ -466,6 +488,7 @@ namespace o2
 
 		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
 		mStackScissors.Add(ScissorStackItem(rect, summaryScissorRect));
+		mScissorChangesCount++;
 
 		glScissor((int)(summaryScissorRect.left + mCurrentResolution.x*0.5f),
 			(int)(summaryScissorRect.bottom + mCurrentResolution.y*0.5f),
@@ -483,6 +506,8 @@ namespace o2
 
 		DrawPrimitives();
 
+		mScissorChangesCount++;
+
 		if (forcible)
 		{
 			glDisable(GL_SCISSOR_TEST);
@@ -522,22 +547,33 @@ namespace o2
 	}
 
 	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+							VertexIndex* indexes, UInt elementsCount, const TextureRef& texture)
 	{
 		if (!mReady)
 			return;
 
-		mDrawingDepth += 1.0f;
+		// Deferred draws have got depth when was added
+		if (!mSubmittingSortedDraws)
+			mDrawingDepth += 1.0f;
 
 		if (mClippingEverything)
 			return;
 
+		if (mDrawsSortingDepth > 0 && !mSubmittingSortedDraws)
+		{
+			AddSortingDrawCall(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+			return;
+		}
+
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
 		else
 			indexesCount = elementsCount*3;
 
+		if (!CheckBatchCapacity(verticesCount, indexesCount))
+			return;
+
 		if (mLastDrawTexture != texture.mTexture ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
@@ -545,6 +581,9 @@ namespace o2
 		{
 			DrawPrimitives();
 
+			if (mLastDrawTexture != texture.mTexture)
+				mTextureSwitchesCount++;
+
 			mLastDrawTexture = texture.mTexture;
 			mCurrentPrimitiveType = primitiveType;
 
@@ -568,7 +607,7 @@ namespace o2
 
 		memcpy(&mVertexData[sizeof(Vertex2)*mLastDrawVertex], vertices, sizeof(Vertex2)*verticesCount);
 
-		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount * 3; i++, j++)
+		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
             mVertexIndexData[i] = mLastDrawVertex + indexes[j];
 
 		if (primitiveType != PrimitiveType::Line)
@@ -578,6 +617,15 @@ namespace o2
 		mLastDrawIdx += indexesCount;
 	}
 
+	void Render::DrawQuadInstances(const QuadInstance* instances, UInt count, const TextureRef& texture)
+	{
+		if (!mReady || count == 0)
+			return;
+
+		// There is no instancing in OpenGL ES 2, quads are expanded into vertices
+		DrawQuadInstancesExpanded(instances, count, texture);
+	}
+
 	void Render::SetRenderTexture(TextureRef renderTarget)
 	{
 		if (!renderTarget)
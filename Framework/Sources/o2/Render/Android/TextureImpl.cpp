@@ -8,7 +8,7 @@ namespace o2
 {
 	Texture::~Texture()
 	{
-		o2Render.mTextures.Remove(this);
+		o2Render.RemoveTexture(this);
 
 		for (auto texRef : mRefs)
 			texRef->mTexture = nullptr;
@@ -94,7 +94,7 @@ namespace o2
 		mFormat = bitmap->GetFormat();
 		mUsage = Usage::Default;
 		mSize = bitmap->GetSize();
-		mFileName = bitmap->GetFilename();
+		SetSource(bitmap->GetFilename(), mAtlasAssetId, mAtlasPage);
 
 		glGenTextures(1, &mHandle);
 		glBindTexture(GL_TEXTURE_2D, mHandle);
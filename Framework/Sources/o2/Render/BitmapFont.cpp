@@ -83,15 +83,15 @@ namespace o2
 		}
 
 		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
-		for (auto heightKV : mCharacters)
+		for (auto table : mCharactersTables)
 		{
-			for (auto charKV : heightKV.second)
+			for (auto& character : table->characters)
 			{
-				charKV.second.mSize = charKV.second.mTexSrc.Size().InvertedY();
-				charKV.second.mTexSrc.left *= invTexSize.x;
-				charKV.second.mTexSrc.right *= invTexSize.x;
-				charKV.second.mTexSrc.top *= invTexSize.y;
-				charKV.second.mTexSrc.bottom *= invTexSize.y;
+				character.mSize = character.mTexSrc.Size().InvertedY();
+				character.mTexSrc.left *= invTexSize.x;
+				character.mTexSrc.right *= invTexSize.x;
+				character.mTexSrc.top *= invTexSize.y;
+				character.mTexSrc.bottom *= invTexSize.y;
 			}
 		}
 
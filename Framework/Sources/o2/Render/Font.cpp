@@ -12,17 +12,37 @@ namespace o2
 	}
 
 	Font::Font(const Font& font):
-		mCharacters(font.mCharacters), mTexture(font.mTexture), 
-		mTextureSrcRect(font.mTextureSrcRect), mReady(font.mReady)
+		mTexture(font.mTexture), mTextureSrcRect(font.mTextureSrcRect), mReady(font.mReady)
 	{
+		for (auto table : font.mCharactersTables)
+			mCharactersTables.Add(mnew CharactersTable(*table));
+
 		o2Render.mFonts.Add(this);
 	}
 
 	Font::~Font()
 	{
+		ClearCharacters();
 		o2Render.mFonts.Remove(this);
 	}
 
+	Font& Font::operator=(const Font& other)
+	{
+		if (this == &other)
+			return *this;
+
+		ClearCharacters();
+
+		for (auto table : other.mCharactersTables)
+			mCharactersTables.Add(mnew CharactersTable(*table));
+
+		mTexture = other.mTexture;
+		mTextureSrcRect = other.mTextureSrcRect;
+		mReady = other.mReady;
+
+		return *this;
+	}
+
 	float Font::GetHeightPx(int height) const
 	{
 		return 1.0f;
@@ -35,14 +55,14 @@ namespace o2
 
 	const Font::Character& Font::GetCharacter(UInt16 id, int height)
 	{
-		auto fndHeight = mCharacters.find(height);
-		if (fndHeight != mCharacters.End())
+		if (Character* character = FindCharacter(id, height))
 		{
-			auto fndChar = fndHeight->second.find(id);
-			if (fndChar != fndHeight->second.End())
-				return fndChar->second;
+			mFoundCharactersCount++;
+			return *character;
 		}
 
+		mMissingCharactersCount++;
+
 		static Character empty;
 		return empty;
 	}
@@ -55,13 +75,169 @@ namespace o2
 		return String();
 	}
 
+	UInt64 Font::GetFoundCharactersCount() const
+	{
+		return mFoundCharactersCount;
+	}
+
+	UInt64 Font::GetMissingCharactersCount() const
+	{
+		return mMissingCharactersCount;
+	}
+
+	UInt64 Font::GetCacheHitsCount() const
+	{
+		return mCacheHitsCount;
+	}
+
+	UInt64 Font::GetCacheMissesCount() const
+	{
+		return mCacheMissesCount;
+	}
+
+	void Font::ResetCharactersCounters()
+	{
+		mFoundCharactersCount = 0;
+		mMissingCharactersCount = 0;
+		mCacheHitsCount = 0;
+		mCacheMissesCount = 0;
+	}
+
 	void Font::AddCharacter(const Character& character)
 	{
-		mCharacters[character.mHeight][character.mId] = character;
+		CharactersTable* table = GetCharactersTable(character.mHeight);
+		if (!table)
+		{
+			table = mnew CharactersTable();
+			table->height = character.mHeight;
+			mCharactersTables.Add(table);
+		}
+
+		table->Add(character);
+	}
+
+	Font::Character* Font::FindCharacter(UInt16 id, int height)
+	{
+		CharactersTable* table = GetCharactersTable(height);
+		if (!table)
+			return nullptr;
+
+		return table->Find(id);
+	}
+
+	Font::CharactersTable* Font::GetCharactersTable(int height)
+	{
+		if (mLastCharactersTable && mLastCharactersTable->height == height)
+		{
+			mCacheHitsCount++;
+			return mLastCharactersTable;
+		}
+
+		mCacheMissesCount++;
+
+		for (auto table : mCharactersTables)
+		{
+			if (table->height == height)
+			{
+				mLastCharactersTable = table;
+				return table;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Font::ClearCharacters()
+	{
+		for (auto table : mCharactersTables)
+			delete table;
+
+		mCharactersTables.Clear();
+		mLastCharactersTable = nullptr;
 	}
 
 	bool Font::Character::operator==(const Character& other) const
 	{
 		return mId == other.mId && mHeight == other.mHeight;
 	}
+
+	Font::CharactersTable::CharactersTable()
+	{
+		directIndex.assign(directIndexSize, -1);
+	}
+
+	Font::Character* Font::CharactersTable::Find(UInt16 id)
+	{
+		if (id < directIndexSize)
+		{
+			int index = directIndex[id];
+			return index < 0 ? nullptr : &characters[index];
+		}
+
+		if (hashIndex.IsEmpty())
+			return nullptr;
+
+		int mask = hashIndex.Count() - 1;
+		for (int cell = HashId(id) & mask; ; cell = (cell + 1) & mask)
+		{
+			int index = hashIndex[cell];
+			if (index < 0)
+				return nullptr;
+
+			if (characters[index].mId == id)
+				return &characters[index];
+		}
+	}
+
+	void Font::CharactersTable::Add(const Character& character)
+	{
+		if (Character* existing = Find(character.mId))
+		{
+			*existing = character;
+			return;
+		}
+
+		int index = characters.Count();
+		characters.Add(character);
+
+		if (character.mId < directIndexSize)
+		{
+			directIndex[character.mId] = index;
+			return;
+		}
+
+		// Load factor is kept below 0.5, so probing sequences are short and there is always empty cell
+		if ((hashedCount + 1)*2 > hashIndex.Count())
+			RehashIndex(Math::Max(hashIndex.Count()*2, 64));
+
+		InsertHashed(character.mId, index);
+		hashedCount++;
+	}
+
+	void Font::CharactersTable::InsertHashed(UInt16 id, int index)
+	{
+		int mask = hashIndex.Count() - 1;
+		int cell = HashId(id) & mask;
+		while (hashIndex[cell] >= 0)
+			cell = (cell + 1) & mask;
+
+		hashIndex[cell] = index;
+	}
+
+	void Font::CharactersTable::RehashIndex(int size)
+	{
+		hashIndex.assign(size, -1);
+
+		for (int i = 0; i < characters.Count(); i++)
+		{
+			if (characters[i].mId >= directIndexSize)
+				InsertHashed(characters[i].mId, i);
+		}
+	}
+
+	int Font::CharactersTable::HashId(UInt16 id)
+	{
+		// Fibonacci hashing spreads sequential ids of one script over the table
+		return (int)((id*2654435769u) >> 16);
+	}
 }
@@ -38,13 +38,16 @@ namespace o2
 		// Destructor
 		virtual ~Font();
 
+		// Copy-operator, copies characters tables
+		Font& operator=(const Font& other);
+
 		// Returns base height in pixels for font with size
 		virtual float GetHeightPx(int height) const;
 
 		// Returns line height in pixels for font with size
 		virtual float GetLineHeightPx(int height) const;
 
-		// Returns character constant reference by id
+		// Returns character constant reference by id. Reference is valid until new characters are added
 		virtual const Character& GetCharacter(UInt16 id, int height);
 
 		// Checks characters for preloading
@@ -53,6 +56,21 @@ namespace o2
 		// Returns font file name
 		virtual String GetFileName() const;
 
+		// Returns count of found characters in GetCharacter
+		UInt64 GetFoundCharactersCount() const;
+
+		// Returns count of not found characters in GetCharacter
+		UInt64 GetMissingCharactersCount() const;
+
+		// Returns count of characters table lookups, resolved by last used table
+		UInt64 GetCacheHitsCount() const;
+
+		// Returns count of characters table lookups, that required searching tables by height
+		UInt64 GetCacheMissesCount() const;
+
+		// Resets found and missing characters counters and cache hits and misses counters
+		void ResetCharactersCounters();
+
 	protected:
 		// --------------------
 		// Character definition
@@ -69,10 +87,49 @@ namespace o2
 			bool operator==(const Character& other) const;
 		};
 
+		// ---------------------------------------------------------------------------------------------------
+		// Characters of one height. Characters are stored densely; ids of ASCII and Latin ranges are indexed
+		// directly, other ids are indexed by open addressing hash table with linear probing
+		// ---------------------------------------------------------------------------------------------------
+		struct CharactersTable
+		{
+			static constexpr int directIndexSize = 0x250; // Size of direct index: ASCII, Latin-1 and Latin Extended-A, B
+
+			int               height = 0;      // Characters height
+			Vector<Character> characters;      // Characters
+			Vector<int>       directIndex;     // Characters indices by id for ids less than directIndexSize, -1 when not exists
+			Vector<int>       hashIndex;       // Open addressing hash table of other characters indices, -1 for empty cell. Size is power of two
+			int               hashedCount = 0; // Count of characters in hash table
+
+			// Default constructor, initializes direct index
+			CharactersTable();
+
+			// Returns character by id, null when not exists
+			Character* Find(UInt16 id);
+
+			// Adds character or replaces existing with same id
+			void Add(const Character& character);
+
+			// Inserts character index into hash table
+			void InsertHashed(UInt16 id, int index);
+
+			// Rebuilds hash table with new size
+			void RehashIndex(int size);
+
+			// Returns hash of character id
+			static int HashId(UInt16 id);
+		};
+
 	protected:
 		Vector<FontRef*>  mRefs; // Array of reference to this font
 
-		Map<int, Map<UInt16, Character>> mCharacters; // Characters map, int - height, uint16 - id
+		Vector<CharactersTable*> mCharactersTables;              // Characters tables by heights
+		CharactersTable*         mLastCharactersTable = nullptr; // Last used characters table, text usually requests many characters with same height
+
+		UInt64 mFoundCharactersCount = 0;   // Count of found characters in GetCharacter
+		UInt64 mMissingCharactersCount = 0; // Count of not found characters in GetCharacter
+		UInt64 mCacheHitsCount = 0;         // Count of characters table lookups, resolved by last used table
+		UInt64 mCacheMissesCount = 0;       // Count of characters table lookups, that required searching tables by height
 
 		TextureRef mTexture;        // Texture
 		RectI      mTextureSrcRect; // Texture source rectangle
@@ -80,9 +137,18 @@ namespace o2
 		bool mReady; // True when font is ready to use
 
 	protected:
-		// Adds character and registers in cache map
+		// Adds character and registers in characters table of its height
 		void AddCharacter(const Character& character);
 
+		// Returns character by id and height, null when not exists
+		Character* FindCharacter(UInt16 id, int height);
+
+		// Returns characters table for height, null when not exists
+		CharactersTable* GetCharactersTable(int height);
+
+		// Removes all characters
+		void ClearCharacters();
+
 		friend class Text;
 		friend class FontRef;
 		friend class Render;
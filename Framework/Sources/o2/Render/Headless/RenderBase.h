@@ -0,0 +1,42 @@
+#pragma once
+
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/String.h"
+#include "o2/Utils/Math/Vector2.h"
+
+namespace o2
+{
+	class OutFile;
+	class Texture;
+
+	// -------------------------------------------------------------------------------------
+	// Headless render base fields. Keeps batching buffers without any graphics device, used
+	// for profiling batching and running scenes on machines without GPU
+	// -------------------------------------------------------------------------------------
+	class RenderBase
+	{
+	public:
+		// Starts recording batches into file. Each DIP is written as a text line
+		void BeginBatchesRecording(const String& fileName);
+
+		// Stops recording batches and closes file
+		void EndBatchesRecording();
+
+		// Returns true when batches are recording
+		bool IsBatchesRecording() const;
+
+	protected:
+		UInt8*       mVertexData;               // Vertex data buffer
+		VertexIndex* mVertexIndexData;          // Index data buffer
+		UInt         mVertexBufferSize = 6000;  // Maximum size of vertex buffer
+		UInt         mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		UInt     mTexturesHandlesCounter = 0;  // Counter for generating textures handles
+		OutFile* mBatchesRecordFile = nullptr; // Batches recording file. Null when not recording
+		UInt     mRecordingFrame = 0;          // Current recording frame index
+	};
+};
+
+#endif // O2_HEADLESS || PLATFORM_LINUX
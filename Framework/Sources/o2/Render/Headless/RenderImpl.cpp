@@ -0,0 +1,467 @@
+#include "o2/stdafx.h"
+
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+#include "o2/Render/Render.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Assets/Assets.h"
+#include "o2/Render/Font.h"
+#include "o2/Render/Mesh.h"
+#include "o2/Render/QuadInstance.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/File.h"
+
+namespace o2
+{
+	Render::Render() :
+		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
+	{
+		mVertexBufferSize = mDefaultBatchVerticesCapacity;
+		mIndexBufferSize = mDefaultBatchIndexesCapacity;
+
+		// Create log stream
+		mLog = mnew LogStream("Render");
+		o2Debug.GetLog()->BindStream(mLog);
+
+		mLog->Out("Initializing headless render..");
+
+		mResolution = o2Application.GetContentSize();
+
+		CheckCompatibles();
+
+		// Initialize buffers
+		mVertexData = mnew UInt8[mVertexBufferSize * sizeof(Vertex2)];
+
+		mVertexIndexData = mnew VertexIndex[mIndexBufferSize];
+		mLastDrawVertex = 0;
+		mTrianglesCount = 0;
+		mFrameTrianglesCount = 0;
+		mDIPCount = 0;
+		mTextureSwitchesCount = 0;
+		mScissorChangesCount = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		mDPI = Vec2I(96, 96);
+
+		InitializeFreeType();
+		InitializeLinesIndexBuffer();
+		InitializeQuadsIndexBuffer();
+		InitializeLinesTextures();
+
+		mCurrentRenderTarget = TextureRef();
+
+		if (IsDevMode())
+			o2Assets.onAssetsRebuilt += MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		mReady = true;
+	}
+
+	Render::~Render()
+	{
+		if (!mReady)
+			return;
+
+		if (IsDevMode())
+			o2Assets.onAssetsRebuilt -= MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		EndBatchesRecording();
+
+		mSolidLineTexture = TextureRef::Null();
+		mDashLineTexture = TextureRef::Null();
+
+		auto fonts = mFonts;
+		for (auto font : fonts)
+			delete font;
+
+		auto textures = mTextures;
+		for (auto texture : textures)
+			delete texture;
+
+		delete[] mVertexData;
+		delete[] mVertexIndexData;
+		delete[] mHardLinesIndexData;
+		delete[] mQuadsIndexData;
+
+		DeinitializeFreeType();
+
+		mReady = false;
+	}
+
+	void Render::OnBatchCapacityChanged()
+	{}
+
+	void Render::CheckCompatibles()
+	{
+		mRenderTargetsAvailable = true;
+		mMaxTextureSize = Vec2I(8192, 8192);
+	}
+
+	void Render::Begin()
+	{
+		if (!mReady)
+			return;
+
+		mLastDrawTexture = NULL;
+		mLastDrawVertex = 0;
+		mLastDrawIdx = 0;
+		mTrianglesCount = 0;
+		mFrameTrianglesCount = 0;
+		mDIPCount = 0;
+		mTextureSwitchesCount = 0;
+		mScissorChangesCount = 0;
+		mSortingSavedDIPsCount = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		mDrawingDepth = 0.0f;
+
+		mScissorInfos.Clear();
+		mStackScissors.Clear();
+
+		mClippingEverything = false;
+
+		if (mBatchesRecordFile)
+		{
+			String frameHeader = String::Format("frame %i\n", mRecordingFrame);
+			mBatchesRecordFile->WriteData(frameHeader.Data(), frameHeader.Length());
+		}
+
+		SetupViewMatrix(mResolution);
+		UpdateCameraTransforms();
+
+		preRender();
+		preRender.Clear();
+	}
+
+	void Render::DrawPrimitives()
+	{
+		SubmitSortedDraws();
+
+		if (mLastDrawVertex < 1)
+			return;
+
+		if (mBatchesRecordFile)
+		{
+			static const char* primitiveTypeNames[3]{ "polygon", "wire", "line" };
+
+			RectI scissorRect = GetResScissorRect();
+			String batchRecord = String::Format("dip %s texture %i vertices %i indexes %i triangles %i scissor %i %i %i %i\n",
+												primitiveTypeNames[(int)mCurrentPrimitiveType],
+												mLastDrawTexture ? mLastDrawTexture->mHandle : 0,
+												mLastDrawVertex, mLastDrawIdx, mTrianglesCount,
+												scissorRect.left, scissorRect.bottom, scissorRect.right, scissorRect.top);
+
+			mBatchesRecordFile->WriteData(batchRecord.Data(), batchRecord.Length());
+		}
+
+		mFrameTrianglesCount += mTrianglesCount;
+		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
+
+		mDIPCount++;
+	}
+
+	void Render::SetupViewMatrix(const Vec2I& viewSize)
+	{
+		mCurrentResolution = viewSize;
+		mCamera = Camera();
+
+		UpdateCameraTransforms();
+	}
+
+	void Render::End()
+	{
+		if (!mReady)
+			return;
+
+		postRender();
+		postRender.Clear();
+
+		DrawPrimitives();
+
+		if (mBatchesRecordFile)
+		{
+			String frameFooter = String::Format("end dips %i triangles %i textures %i scissors %i saved %i\n",
+												mDIPCount, mFrameTrianglesCount, mTextureSwitchesCount,
+												mScissorChangesCount, mSortingSavedDIPsCount);
+
+			mBatchesRecordFile->WriteData(frameFooter.Data(), frameFooter.Length());
+			mRecordingFrame++;
+		}
+
+		CheckTexturesUnloading();
+		CheckFontsUnloading();
+	}
+
+	void Render::Clear(const Color4& color /*= Color4::Blur()*/)
+	{}
+
+	void Render::UpdateCameraTransforms()
+	{
+		DrawPrimitives();
+
+		Vec2F resf = (Vec2F)mCurrentResolution;
+
+		Basis defaultCameraBasis((Vec2F)mCurrentResolution*-0.5f, Vec2F::Right()*resf.x, Vec2F().Up()*resf.y);
+		Basis camTransf = mCamera.GetBasis().Inverted()*defaultCameraBasis;
+		mViewScale = Vec2F(camTransf.xv.Length(), camTransf.yv.Length());
+		mInvViewScale = Vec2F(1.0f / mViewScale.x, 1.0f / mViewScale.y);
+	}
+
+	void Render::BeginRenderToStencilBuffer()
+	{
+		if (mStencilDrawing || mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mStencilDrawing = true;
+	}
+
+	void Render::EndRenderToStencilBuffer()
+	{
+		if (!mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mStencilDrawing = false;
+	}
+
+	void Render::EnableStencilTest()
+	{
+		if (mStencilTest || mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mStencilTest = true;
+	}
+
+	void Render::DisableStencilTest()
+	{
+		if (!mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mStencilTest = false;
+	}
+
+	void Render::ClearStencil()
+	{}
+
+	void Render::EnableScissorTest(const RectI& rect)
+	{
+		DrawPrimitives();
+
+		RectI summaryScissorRect = rect;
+		if (!mStackScissors.IsEmpty())
+		{
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+
+			if (!mStackScissors.Last().mRenderTarget)
+			{
+				RectI lastSummaryClipRect = mStackScissors.Last().mSummaryScissorRect;
+				mClippingEverything = !summaryScissorRect.IsIntersects(lastSummaryClipRect);
+				summaryScissorRect = summaryScissorRect.GetIntersection(lastSummaryClipRect);
+			}
+			else mClippingEverything = false;
+		}
+		else mClippingEverything = false;
+
+		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
+		mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
+		mScissorChangesCount++;
+	}
+
+	void Render::DisableScissorTest(bool forcible /*= false*/)
+	{
+		if (mStackScissors.IsEmpty())
+		{
+			mLog->WarningStr("Can't disable scissor test - no scissor were enabled!");
+			return;
+		}
+
+		DrawPrimitives();
+
+		mScissorChangesCount++;
+
+		if (forcible)
+		{
+			while (!mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget)
+				mStackScissors.PopBack();
+
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+		}
+		else
+		{
+			if (mStackScissors.Count() == 1)
+			{
+				mStackScissors.PopBack();
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mClippingEverything = false;
+			}
+			else
+			{
+				mStackScissors.PopBack();
+				RectI lastClipRect = mStackScissors.Last().mSummaryScissorRect;
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mScissorInfos.Add(ScissorInfo(lastClipRect, mDrawingDepth));
+
+				if (mStackScissors.Last().mRenderTarget)
+					mClippingEverything = false;
+				else
+					mClippingEverything = lastClipRect == RectI();
+			}
+		}
+	}
+
+	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							VertexIndex* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (!mReady)
+			return;
+
+		// Deferred draws have got depth when was added
+		if (!mSubmittingSortedDraws)
+			mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		if (mDrawsSortingDepth > 0 && !mSubmittingSortedDraws)
+		{
+			AddSortingDrawCall(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+			return;
+		}
+
+		UInt indexesCount;
+		if (primitiveType == PrimitiveType::Line)
+			indexesCount = elementsCount * 2;
+		else
+			indexesCount = elementsCount * 3;
+
+		if (!CheckBatchCapacity(verticesCount, indexesCount))
+			return;
+
+		if (mLastDrawTexture != texture.mTexture ||
+			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
+			mCurrentPrimitiveType != primitiveType)
+		{
+			DrawPrimitives();
+
+			if (mLastDrawTexture != texture.mTexture)
+				mTextureSwitchesCount++;
+
+			mLastDrawTexture = texture.mTexture;
+			mCurrentPrimitiveType = primitiveType;
+		}
+
+		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
+
+		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
+			mVertexIndexData[i] = mLastDrawVertex + indexes[j];
+
+		if (primitiveType != PrimitiveType::Line)
+			mTrianglesCount += elementsCount;
+
+		mLastDrawVertex += verticesCount;
+		mLastDrawIdx += indexesCount;
+	}
+
+	void Render::DrawQuadInstances(const QuadInstance* instances, UInt count, const TextureRef& texture)
+	{
+		if (!mReady || count == 0)
+			return;
+
+		DrawQuadInstancesExpanded(instances, count, texture);
+	}
+
+	void Render::BindRenderTexture(TextureRef renderTarget)
+	{
+		if (!renderTarget)
+		{
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (renderTarget->mUsage != Texture::Usage::RenderTarget)
+		{
+			mLog->Error("Can't set texture as render target: not render target texture");
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (!renderTarget->IsReady())
+		{
+			mLog->Error("Can't set texture as render target: texture isn't ready");
+			UnbindRenderTexture();
+			return;
+		}
+
+		DrawPrimitives();
+
+		if (!mStackScissors.IsEmpty())
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+
+		mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
+
+		SetupViewMatrix(renderTarget->GetSize());
+
+		mCurrentRenderTarget = renderTarget;
+	}
+
+	void Render::UnbindRenderTexture()
+	{
+		if (!mCurrentRenderTarget)
+			return;
+
+		DrawPrimitives();
+
+		SetupViewMatrix(mResolution);
+
+		mCurrentRenderTarget = TextureRef();
+
+		DisableScissorTest(true);
+		mStackScissors.PopBack();
+		if (!mStackScissors.IsEmpty())
+			mClippingEverything = mStackScissors.Last().mSummaryScissorRect == RectI();
+	}
+
+	void RenderBase::BeginBatchesRecording(const String& fileName)
+	{
+		EndBatchesRecording();
+
+		mBatchesRecordFile = mnew OutFile(fileName);
+		if (!mBatchesRecordFile->IsOpened())
+		{
+			o2Debug.LogError("Can't open batches record file: " + fileName);
+			delete mBatchesRecordFile;
+			mBatchesRecordFile = nullptr;
+		}
+
+		mRecordingFrame = 0;
+	}
+
+	void RenderBase::EndBatchesRecording()
+	{
+		if (!mBatchesRecordFile)
+			return;
+
+		mBatchesRecordFile->Close();
+		delete mBatchesRecordFile;
+		mBatchesRecordFile = nullptr;
+	}
+
+	bool RenderBase::IsBatchesRecording() const
+	{
+		return mBatchesRecordFile != nullptr;
+	}
+}
+
+#endif // O2_HEADLESS || PLATFORM_LINUX
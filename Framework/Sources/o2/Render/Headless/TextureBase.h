@@ -0,0 +1,19 @@
+#pragma once
+
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	class TextureBase
+	{
+		friend class Render;
+		friend class VectorFont;
+
+	protected:
+		UInt mHandle = 0; // Texture handle, unique identifier used in batches records
+	};
+}
+
+#endif // O2_HEADLESS || PLATFORM_LINUX
@@ -0,0 +1,68 @@
+#include "o2/stdafx.h"
+
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+#include "o2/Render/Texture.h"
+
+#include "o2/Render/Render.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+
+namespace o2
+{
+	Texture::~Texture()
+	{
+		o2Render.RemoveTexture(this);
+	}
+
+	void Texture::Create(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/)
+	{
+		mFormat = format;
+		mUsage = usage;
+		mSize = size;
+
+		if (mHandle == 0)
+			mHandle = ++o2Render.mTexturesHandlesCounter;
+
+		mReady = true;
+	}
+
+	void Texture::Create(Bitmap* bitmap)
+	{
+		mFormat = bitmap->GetFormat();
+		mUsage = Usage::Default;
+		mSize = bitmap->GetSize();
+		SetSource(bitmap->GetFilename(), mAtlasAssetId, mAtlasPage);
+
+		if (mHandle == 0)
+			mHandle = ++o2Render.mTexturesHandlesCounter;
+
+		mReady = true;
+	}
+
+	void Texture::SetData(Bitmap* bitmap)
+	{
+		mSize = bitmap->GetSize();
+	}
+
+	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
+	{}
+
+	void Texture::Copy(const Texture& from, const RectI& rect)
+	{}
+
+	Bitmap* Texture::GetData()
+	{
+		return mnew Bitmap(mFormat, mSize);
+	}
+
+	void Texture::SetFilter(Filter filter)
+	{
+		mFilter = filter;
+	}
+
+	Texture::Filter Texture::GetFilter() const
+	{
+		return mFilter;
+	}
+}
+
+#endif // O2_HEADLESS || PLATFORM_LINUX
@@ -1,9 +1,9 @@
 #include "o2/stdafx.h"
 #include "ParticlesEmitter.h"
 
-#include "o2/Render/Mesh.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include "o2/Render/Render.h"
 
 namespace o2
 {
@@ -11,14 +11,12 @@ namespace o2
 		IRectDrawable()
 	{
 		mShape = mnew CircleParticlesEmitterShape();
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mParticlesTexture = NoTexture();
 		mLastTransform = mTransform;
 	}
 
 	ParticlesEmitter::~ParticlesEmitter()
 	{
-		delete mParticlesMesh;
-
 		for (auto effect : mEffects)
 			delete effect;
 	}
@@ -40,7 +38,7 @@ namespace o2
 		emitParticlesSpeedRange(this), emitParticlesMoveDir(this), emitParticlesMoveDirRange(this), emitParticlesColorA(this), emitParticlesColorB(this),
 		image(this), shape(this)
 	{
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mParticlesTexture = other.mParticlesTexture;
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
@@ -104,9 +102,8 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mParticlesTexture = other.mParticlesTexture;
+		mParticlesQuads.Clear();
 
 		mLastTransform = mTransform;
 
@@ -115,7 +112,7 @@ namespace o2
 
 	void ParticlesEmitter::Draw()
 	{
-		mParticlesMesh->Draw();
+		o2Render.DrawQuadInstances(mParticlesQuads.Data(), mParticlesQuads.Count(), mParticlesTexture);
 	}
 
 	void ParticlesEmitter::Update(float dt)
@@ -233,19 +230,11 @@ namespace o2
 
 	void ParticlesEmitter::UpdateMesh()
 	{
-		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
-			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
-
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
+		mParticlesQuads.Clear();
 
 		Vec2F invTexSize(1.0f, 1.0f);
-		if (mParticlesMesh->GetTexture())
-		{
-			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
-						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
-		}
+		if (mParticlesTexture)
+			invTexSize.Set(1.0f/mParticlesTexture->GetSize().x, 1.0f/mParticlesTexture->GetSize().y);
 
 		RectF textureSrcRect;
 		if (mImageAsset)
@@ -262,25 +251,19 @@ namespace o2
 				continue;
 
 			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			Vec2F xv(cs*particle.size.x, sn*particle.size.x);
+			Vec2F yv(-sn*particle.size.y, cs*particle.size.y);
+			Vec2F origin = particle.position - (xv + yv)*0.5f;
+
+			QuadInstance& quad = mParticlesQuads.Add(QuadInstance());
+			quad.origin = origin;
+			quad.xv = xv;
+			quad.yv = yv;
+			quad.uvLeft = uvLeft;
+			quad.uvUp = uvUp;
+			quad.uvRight = uvRight;
+			quad.uvDown = uvDown;
+			quad.color = particle.color.ARGB();
 		}
 	}
 
@@ -331,9 +314,9 @@ namespace o2
 		mImageAsset = image;
 
 		if (mImageAsset)
-			mParticlesMesh->SetTexture(TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage()));
+			mParticlesTexture = TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage());
 		else
-			mParticlesMesh->SetTexture(NoTexture());
+			mParticlesTexture = NoTexture();
 	}
 
 	ImageAssetRef ParticlesEmitter::GetImage() const
@@ -4,13 +4,12 @@
 #include "o2/Render/Particle.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include "o2/Render/QuadInstance.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Utils/Math/Curve.h"
 
 namespace o2
 {
-	class Mesh;
-
 	// ------------------------------------------------------
 	// Particles emitter. Emits, updates and manage particles
 	// ------------------------------------------------------
@@ -270,13 +269,14 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		float                mCurrentTime = 0;       // Current working time in seconds
+		float                mEmitTimeBuffer = 0;    // Emitting next particle time buffer
+		TextureRef           mParticlesTexture;      // Particles texture
+		Vector<QuadInstance> mParticlesQuads;        // Particles quads, one per alive particle
+		Vector<Particle>     mParticles;             // Working particles
+		Vector<int>          mDeadParticles;         // Dead particles indexes
+		int                  mNumAliveParticles = 0; // Count of current alive particles
+		Basis                mLastTransform;         // Last transformation
 
 	protected:
 		// Emits particles hen updating
@@ -288,7 +288,7 @@ namespace o2
 		// Updates particles
 		void UpdateParticles(float dt);
 
-		// Updates mesh geometry
+		// Updates particles quads
 		void UpdateMesh(); 
 		
 		// It is called when basis was changed, updates particles positions from last transform
@@ -358,7 +358,8 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mEmitParticlesColorB).PROTECTED();
 	FIELD().DEFAULT_VALUE(0).NAME(mCurrentTime).PROTECTED();
 	FIELD().DEFAULT_VALUE(0).NAME(mEmitTimeBuffer).PROTECTED();
-	FIELD().DEFAULT_VALUE(nullptr).NAME(mParticlesMesh).PROTECTED();
+	FIELD().NAME(mParticlesTexture).PROTECTED();
+	FIELD().NAME(mParticlesQuads).PROTECTED();
 	FIELD().NAME(mParticles).PROTECTED();
 	FIELD().NAME(mDeadParticles).PROTECTED();
 	FIELD().DEFAULT_VALUE(0).NAME(mNumAliveParticles).PROTECTED();
@@ -0,0 +1,91 @@
+#include "o2/stdafx.h"
+#include "QuadInstance.h"
+
+#if defined __SSE2__ || defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define QUAD_INSTANCE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	QuadInstance::QuadInstance():
+		uvLeft(0), uvUp(1), uvRight(1), uvDown(0), color(0xffffffff)
+	{}
+
+	QuadInstance::QuadInstance(const Basis& basis, float uvLeft, float uvUp, float uvRight, float uvDown, ULong color):
+		origin(basis.origin), xv(basis.xv), yv(basis.yv), uvLeft(uvLeft), uvUp(uvUp), uvRight(uvRight), uvDown(uvDown),
+		color(color)
+	{}
+
+	void QuadInstance::Set(const Basis& basis, float uvLeft, float uvUp, float uvRight, float uvDown, ULong color)
+	{
+		origin = basis.origin;
+		xv = basis.xv;
+		yv = basis.yv;
+		this->uvLeft = uvLeft;
+		this->uvUp = uvUp;
+		this->uvRight = uvRight;
+		this->uvDown = uvDown;
+		this->color = color;
+	}
+
+	bool QuadInstance::operator==(const QuadInstance& other) const
+	{
+		return origin == other.origin && xv == other.xv && yv == other.yv && color == other.color &&
+			Math::Equals(uvLeft, other.uvLeft) && Math::Equals(uvUp, other.uvUp) &&
+			Math::Equals(uvRight, other.uvRight) && Math::Equals(uvDown, other.uvDown);
+	}
+
+	void QuadInstance::ExpandVertices(const QuadInstance* instances, UInt count, Vertex2* vertices)
+	{
+#if defined QUAD_INSTANCE_SSE
+		const __m128 zero = _mm_setzero_ps();
+#endif
+
+		for (UInt i = 0; i < count; i++)
+		{
+			const QuadInstance& quad = instances[i];
+			Vertex2* v = vertices + i*4;
+
+#if defined QUAD_INSTANCE_SSE
+			// Two corners per register: (left top, right top) and (right bottom, left bottom)
+			__m128 originXv = _mm_loadu_ps(&quad.origin.x);
+			__m128 yvUv = _mm_loadu_ps(&quad.yv.x);
+
+			__m128 origin2 = _mm_movelh_ps(originXv, originXv);
+			__m128 xv2 = _mm_movehl_ps(originXv, originXv);
+			__m128 yv2 = _mm_movelh_ps(yvUv, yvUv);
+
+			__m128 top = _mm_add_ps(_mm_add_ps(origin2, yv2), _mm_movelh_ps(zero, xv2));
+			__m128 bottom = _mm_add_ps(origin2, _mm_movelh_ps(xv2, zero));
+
+			_mm_storel_pi((__m64*)&v[0].x, top);
+			_mm_storeh_pi((__m64*)&v[1].x, top);
+			_mm_storel_pi((__m64*)&v[2].x, bottom);
+			_mm_storeh_pi((__m64*)&v[3].x, bottom);
+#else
+			v[0].x = quad.origin.x + quad.yv.x;             v[0].y = quad.origin.y + quad.yv.y;
+			v[1].x = quad.origin.x + quad.yv.x + quad.xv.x; v[1].y = quad.origin.y + quad.yv.y + quad.xv.y;
+			v[2].x = quad.origin.x + quad.xv.x;             v[2].y = quad.origin.y + quad.xv.y;
+			v[3].x = quad.origin.x;                         v[3].y = quad.origin.y;
+#endif
+
+			v[0].z = 1.0f; v[0].color = quad.color; v[0].tu = quad.uvLeft; v[0].tv = quad.uvUp;
+			v[1].z = 1.0f; v[1].color = quad.color; v[1].tu = quad.uvRight; v[1].tv = quad.uvUp;
+			v[2].z = 1.0f; v[2].color = quad.color; v[2].tu = quad.uvRight; v[2].tv = quad.uvDown;
+			v[3].z = 1.0f; v[3].color = quad.color; v[3].tu = quad.uvLeft; v[3].tv = quad.uvDown;
+		}
+	}
+
+	void QuadInstance::FillIndexes(VertexIndex* indexes, UInt count)
+	{
+		for (UInt i = 0; i < count; i++)
+		{
+			VertexIndex first = (VertexIndex)(i*4);
+			VertexIndex* idx = indexes + i*6;
+
+			idx[0] = first;     idx[1] = first + 1; idx[2] = first + 2;
+			idx[3] = first;     idx[4] = first + 2; idx[5] = first + 3;
+		}
+	}
+}
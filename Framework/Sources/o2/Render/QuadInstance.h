@@ -0,0 +1,42 @@
+#pragma once
+
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Vertex2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------
+	// Compact textured quad record. Expands into 4 vertices on GPU when instancing is available,
+	// otherwise on CPU. Quad corners are origin, origin + xv, origin + xv + yv, origin + yv
+	// ---------------------------------------------------------------------------------------------
+	struct QuadInstance
+	{
+		Vec2F origin;  // Left bottom corner position
+		Vec2F xv;      // Quad x axis
+		Vec2F yv;      // Quad y axis
+		float uvLeft;  // Left texture coordinate
+		float uvUp;    // Top texture coordinate
+		float uvRight; // Right texture coordinate
+		float uvDown;  // Bottom texture coordinate
+		ULong color;   // Vertices color
+
+		// Default constructor
+		QuadInstance();
+
+		// Constructor from basis, texture coordinates and color
+		QuadInstance(const Basis& basis, float uvLeft, float uvUp, float uvRight, float uvDown, ULong color);
+
+		// Sets quad parameters
+		void Set(const Basis& basis, float uvLeft, float uvUp, float uvRight, float uvDown, ULong color);
+
+		// Check equals operator
+		bool operator==(const QuadInstance& other) const;
+
+		// Expands quads into vertices, 4 vertices per quad in order left top, right top, right bottom, left bottom
+		static void ExpandVertices(const QuadInstance* instances, UInt count, Vertex2* vertices);
+
+		// Fills indexes for quads expanded by ExpandVertices, 6 indexes per quad
+		static void FillIndexes(VertexIndex* indexes, UInt count);
+	};
+}
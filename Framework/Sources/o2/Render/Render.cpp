@@ -5,12 +5,14 @@
 #include "o2/Assets/Assets.h"
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
+#include "o2/Render/QuadInstance.h"
 #include "o2/Render/Sprite.h"
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
+#include "o2/Utils/Tools/DataHash.h"
 #include "o2/Application/Input.h"
 
 namespace o2
@@ -24,7 +26,7 @@ namespace o2
 
 	void Render::InitializeLinesIndexBuffer()
 	{
-		mHardLinesIndexData = mnew UInt16[mIndexBufferSize];
+		mHardLinesIndexData = mnew VertexIndex[mIndexBufferSize];
 
 		for (UInt i = 0; i < mIndexBufferSize/2; i++)
 		{
@@ -33,6 +35,28 @@ namespace o2
 		}
 	}
 
+	void Render::InitializeQuadsIndexBuffer()
+	{
+		mQuadsIndexData = mnew VertexIndex[mIndexBufferSize];
+		QuadInstance::FillIndexes(mQuadsIndexData, mIndexBufferSize/6);
+	}
+
+	void Render::DrawQuadInstancesExpanded(const QuadInstance* instances, UInt count, const TextureRef& texture)
+	{
+		UInt maxQuadsCount = Math::Min(mVertexBufferSize/4, mIndexBufferSize/6) - 1;
+
+		for (UInt offset = 0; offset < count; offset += maxQuadsCount)
+		{
+			UInt chunkCount = Math::Min(count - offset, maxQuadsCount);
+
+			if ((UInt)mQuadsVertices.Count() < chunkCount*4)
+				mQuadsVertices.Resize(chunkCount*4);
+
+			QuadInstance::ExpandVertices(instances + offset, chunkCount, mQuadsVertices.Data());
+			DrawBuffer(PrimitiveType::Polygon, mQuadsVertices.Data(), chunkCount*4, mQuadsIndexData, chunkCount*2, texture);
+		}
+	}
+
 	void Render::InitializeLinesTextures()
 	{
 		mSolidLineTexture = TextureRef::Null();
@@ -75,6 +99,99 @@ namespace o2
 		return mDIPCount;
 	}
 
+	int Render::GetTrianglesCount()
+	{
+		return mFrameTrianglesCount;
+	}
+
+	int Render::GetTextureSwitchesCount()
+	{
+		return mTextureSwitchesCount;
+	}
+
+	int Render::GetScissorChangesCount()
+	{
+		return mScissorChangesCount;
+	}
+
+	int Render::GetSortingSavedDrawCallsCount()
+	{
+		return mSortingSavedDIPsCount;
+	}
+
+	void Render::SetBatchCapacity(UInt verticesCount, UInt indexesCount)
+	{
+		const UInt maxVerticesCount = mMaxBatchIndexValue;
+		verticesCount = Math::Min(verticesCount, maxVerticesCount);
+		indexesCount = Math::Min(Math::Max(indexesCount, 2u), mMaxBatchIndexesCount);
+
+		if (verticesCount == mVertexBufferSize && indexesCount == mIndexBufferSize)
+			return;
+
+		DrawPrimitives();
+
+		delete[] mVertexData;
+		delete[] mVertexIndexData;
+		delete[] mHardLinesIndexData;
+		delete[] mQuadsIndexData;
+
+		mVertexBufferSize = verticesCount;
+		mIndexBufferSize = indexesCount;
+
+		mVertexData = mnew UInt8[mVertexBufferSize*sizeof(Vertex2)];
+		mVertexIndexData = mnew VertexIndex[mIndexBufferSize];
+		InitializeLinesIndexBuffer();
+		InitializeQuadsIndexBuffer();
+
+		OnBatchCapacityChanged();
+	}
+
+	UInt Render::GetBatchVerticesCapacity() const
+	{
+		return mVertexBufferSize;
+	}
+
+	UInt Render::GetBatchIndexesCapacity() const
+	{
+		return mIndexBufferSize;
+	}
+
+	bool Render::CheckBatchCapacity(UInt verticesCount, UInt indexesCount)
+	{
+		if (verticesCount < mVertexBufferSize && indexesCount < mIndexBufferSize)
+			return true;
+
+		const UInt maxVerticesCount = mMaxBatchIndexValue;
+		if (verticesCount >= maxVerticesCount)
+		{
+			mLog->Error("Can't draw buffer with " + (String)verticesCount + " vertices: more than maximum vertex index " +
+						(String)maxVerticesCount);
+
+			return false;
+		}
+
+		const UInt maxIndexesCount = mMaxBatchIndexesCount;
+		if (indexesCount >= maxIndexesCount)
+		{
+			mLog->Error("Can't draw buffer with " + (String)indexesCount + " indexes: more than maximum indexes count " +
+						(String)maxIndexesCount);
+
+			return false;
+		}
+
+		// Doubles capacity without overflow, clamped by limit
+		auto growCapacity = [](UInt current, UInt required, UInt limit)
+		{
+			UInt capacity = Math::Max(current, required + 1);
+			return capacity > limit/2 ? limit : capacity*2;
+		};
+
+		SetBatchCapacity(growCapacity(mVertexBufferSize, verticesCount, maxVerticesCount),
+						 growCapacity(mIndexBufferSize, indexesCount, maxIndexesCount));
+
+		return true;
+	}
+
 	void Render::SetCamera(const Camera& camera)
 	{
 		mCamera = camera;
@@ -146,14 +263,117 @@ namespace o2
 		return screenScissorRect;
 	}
 
+	void Render::AddTexture(Texture* texture)
+	{
+		texture->mRenderIndex = mTextures.Count();
+		mTextures.Add(texture);
+
+		IndexTexture(texture);
+
+		if (texture->mRefs == 0)
+			AddTextureUnloadingCandidate(texture);
+	}
+
+	void Render::RemoveTexture(Texture* texture)
+	{
+		UnindexTexture(texture);
+
+		if (texture->mRenderIndex >= 0)
+		{
+			Texture* last = mTextures.Last();
+			mTextures[texture->mRenderIndex] = last;
+			last->mRenderIndex = texture->mRenderIndex;
+			mTextures.PopBack();
+
+			texture->mRenderIndex = -1;
+		}
+
+		if (texture->mUnloadingCandidate)
+		{
+			mTexturesUnloadingCandidates.Remove(texture);
+			texture->mUnloadingCandidate = false;
+		}
+	}
+
+	void Render::IndexTexture(Texture* texture)
+	{
+		if (!texture->mFileName.IsEmpty())
+			mTexturesByFileName.insert({ GetTextureKey(texture->mFileName), texture });
+
+		if (texture->mAtlasAssetId != 0)
+			mTexturesByAtlasPage.insert({ GetTextureKey(texture->mAtlasAssetId, texture->mAtlasPage), texture });
+	}
+
+	void Render::UnindexTexture(Texture* texture)
+	{
+		if (!texture->mFileName.IsEmpty())
+		{
+			auto fnd = mTexturesByFileName.find(GetTextureKey(texture->mFileName));
+			if (fnd != mTexturesByFileName.end() && fnd->second == texture)
+				mTexturesByFileName.erase(fnd);
+		}
+
+		if (texture->mAtlasAssetId != 0)
+		{
+			auto fnd = mTexturesByAtlasPage.find(GetTextureKey(texture->mAtlasAssetId, texture->mAtlasPage));
+			if (fnd != mTexturesByAtlasPage.end() && fnd->second == texture)
+				mTexturesByAtlasPage.erase(fnd);
+		}
+	}
+
+	Texture* Render::FindTexture(const String& fileName) const
+	{
+		auto fnd = mTexturesByFileName.find(GetTextureKey(fileName));
+		if (fnd != mTexturesByFileName.end() && fnd->second->mFileName == fileName)
+			return fnd->second;
+
+		return nullptr;
+	}
+
+	Texture* Render::FindTexture(const UID& atlasAssetId, int page) const
+	{
+		auto fnd = mTexturesByAtlasPage.find(GetTextureKey(atlasAssetId, page));
+		if (fnd != mTexturesByAtlasPage.end() && fnd->second->mAtlasAssetId == atlasAssetId && fnd->second->mAtlasPage == page)
+			return fnd->second;
+
+		return nullptr;
+	}
+
+	void Render::AddTextureUnloadingCandidate(Texture* texture)
+	{
+		if (texture->mUnloadingCandidate)
+			return;
+
+		texture->mUnloadingCandidate = true;
+		mTexturesUnloadingCandidates.Add(texture);
+	}
+
 	void Render::CheckTexturesUnloading()
 	{
-		Vector<Texture*> unloadTextures;
-		for (auto texture : mTextures)
+		if (mTexturesUnloadingCandidates.IsEmpty())
+			return;
+
+		Vector<Texture*> candidates = std::move(mTexturesUnloadingCandidates);
+		mTexturesUnloadingCandidates.Clear();
+
+		for (auto texture : candidates)
+			texture->mUnloadingCandidate = false;
+
+		for (auto texture : candidates)
+		{
 			if (texture->mRefs == 0)
-				unloadTextures.Add(texture);
+				delete texture;
+		}
+	}
 
-		unloadTextures.ForEach([](auto texture) { delete texture; });
+	UInt64 Render::GetTextureKey(const String& fileName)
+	{
+		return GetDataHash(fileName.Data());
+	}
+
+	UInt64 Render::GetTextureKey(const UID& atlasAssetId, int page)
+	{
+		return CombineHash(GetDataHash(atlasAssetId.data, sizeof(atlasAssetId.data)), (UInt64)page);
 	}
 
 	void Render::CheckFontsUnloading()
@@ -554,6 +774,130 @@ namespace o2
 				   mesh->indexes, mesh->polyCount, mesh->mTexture);
 	}
 
+	void Render::BeginDrawsSorting()
+	{
+		mDrawsSortingDepth++;
+	}
+
+	void Render::EndDrawsSorting()
+	{
+		if (mDrawsSortingDepth == 0)
+		{
+			mLog->Error("Can't end draws sorting: sorting wasn't began");
+			return;
+		}
+
+		mDrawsSortingDepth--;
+
+		if (mDrawsSortingDepth == 0)
+			SubmitSortedDraws();
+	}
+
+	bool Render::IsDrawsSorting() const
+	{
+		return mDrawsSortingDepth > 0;
+	}
+
+	void Render::AddSortingDrawCall(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+									VertexIndex* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (verticesCount == 0)
+			return;
+
+		UInt indexesCount = primitiveType == PrimitiveType::Line ? elementsCount*2 : elementsCount*3;
+
+		SortingDrawCall drawCall;
+		drawCall.mPrimitiveType = primitiveType;
+		drawCall.mTexture = texture;
+		drawCall.mVerticesOffset = mSortingVertices.Count();
+		drawCall.mVerticesCount = verticesCount;
+		drawCall.mIndexesOffset = mSortingIndexes.Count();
+		drawCall.mElementsCount = elementsCount;
+
+		RectF bounds(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+		for (UInt i = 0; i < verticesCount; i++)
+		{
+			const Vertex2& vertex = vertices[i];
+			mSortingVertices.Add(vertex);
+
+			bounds.left = Math::Min(bounds.left, vertex.x);
+			bounds.right = Math::Max(bounds.right, vertex.x);
+			bounds.bottom = Math::Min(bounds.bottom, vertex.y);
+			bounds.top = Math::Max(bounds.top, vertex.y);
+		}
+
+		drawCall.mBounds = bounds;
+
+		for (UInt i = 0; i < indexesCount; i++)
+			mSortingIndexes.Add(indexes[i]);
+
+		mSortingDrawCalls.Add(drawCall);
+	}
+
+	void Render::SubmitSortedDraws()
+	{
+		if (mSortingDrawCalls.IsEmpty() || mSubmittingSortedDraws)
+			return;
+
+		// How far draw call can be moved back to the batchable one. Limits sorting cost by O(n*lookBehind)
+		const int lookBehind = 64;
+
+		// Insert each draw call right after the latest batchable draw call, if it doesn't intersect any of draws 
+		// it passes. So intersecting draws keep their visual order
+		Vector<int> order;
+		order.Reserve(mSortingDrawCalls.Count());
+
+		for (int i = 0; i < mSortingDrawCalls.Count(); i++)
+		{
+			const SortingDrawCall& drawCall = mSortingDrawCalls[i];
+			int insertPosition = order.Count();
+
+			for (int j = order.Count() - 1; j >= 0 && j >= order.Count() - lookBehind; j--)
+			{
+				const SortingDrawCall& other = mSortingDrawCalls[order[j]];
+
+				if (drawCall.IsBatchableWith(other))
+				{
+					insertPosition = j + 1;
+					break;
+				}
+
+				if (drawCall.mBounds.IsIntersects(other.mBounds))
+					break;
+			}
+
+			order.Insert(i, insertPosition);
+		}
+
+		int sourceSwitches = 0, sortedSwitches = 0;
+		for (int i = 1; i < mSortingDrawCalls.Count(); i++)
+		{
+			if (!mSortingDrawCalls[i].IsBatchableWith(mSortingDrawCalls[i - 1]))
+				sourceSwitches++;
+
+			if (!mSortingDrawCalls[order[i]].IsBatchableWith(mSortingDrawCalls[order[i - 1]]))
+				sortedSwitches++;
+		}
+
+		if (sourceSwitches > sortedSwitches)
+			mSortingSavedDIPsCount += sourceSwitches - sortedSwitches;
+
+		mSubmittingSortedDraws = true;
+
+		for (int idx : order)
+		{
+			const SortingDrawCall& drawCall = mSortingDrawCalls[idx];
+			DrawBuffer(drawCall.mPrimitiveType, mSortingVertices.Data() + drawCall.mVerticesOffset, drawCall.mVerticesCount,
+					   mSortingIndexes.Data() + drawCall.mIndexesOffset, drawCall.mElementsCount, drawCall.mTexture);
+		}
+
+		mSubmittingSortedDraws = false;
+
+		mSortingDrawCalls.Clear();
+		mSortingVertices.Clear();
+		mSortingIndexes.Clear();
+	}
+
 	void Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
 	{
 		auto dcolor = color.ABGR();
@@ -664,4 +1008,14 @@ namespace o2
 	{
 		return mScrissorRect == other.mScrissorRect;
 	}
+
+	bool Render::SortingDrawCall::IsBatchableWith(const SortingDrawCall& other) const
+	{
+		return mTexture == other.mTexture && mPrimitiveType == other.mPrimitiveType;
+	}
+
+	bool Render::SortingDrawCall::operator==(const SortingDrawCall& other) const
+	{
+		return mVerticesOffset == other.mVerticesOffset && mIndexesOffset == other.mIndexesOffset;
+	}
 }
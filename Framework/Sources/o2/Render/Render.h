@@ -3,7 +3,9 @@
 #include "ft2build.h"
 #include FT_FREETYPE_H
 
-#if defined PLATFORM_WINDOWS
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+#include "o2/Render/Headless/RenderBase.h"
+#elif defined PLATFORM_WINDOWS
 #include "o2/Render/Windows/RenderBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/RenderBase.h"
@@ -14,6 +16,8 @@
 #include "o2/Utils/Math/Vertex2.h"
 #include "o2/Utils/Singleton.h"
 
+#include <unordered_map>
+
 // Render access macros
 #define o2Render o2::Render::Instance()
 
@@ -21,6 +25,7 @@ namespace o2
 {
 	class Mesh;
 	class Font;
+	struct QuadInstance;
 	class Sprite;
 	class CursorAreaEventListenersLayer;
 
@@ -60,6 +65,25 @@ namespace o2
 			bool operator==(const ScissorStackEntry& other) const;
 		};
 
+		// -----------------------------------------------------------------
+		// Deferred draw call, collected while draws sorting by texture is on
+		// -----------------------------------------------------------------
+		struct SortingDrawCall
+		{
+			PrimitiveType mPrimitiveType;  // Type of drawing primitives
+			TextureRef    mTexture;        // Drawing texture
+			UInt          mVerticesOffset; // Offset of vertices in sorting vertices buffer
+			UInt          mVerticesCount;  // Count of vertices
+			UInt          mIndexesOffset;  // Offset of indexes in sorting indexes buffer
+			UInt          mElementsCount;  // Count of polygons or lines
+			RectF         mBounds;         // Vertices bounds
+
+			// Returns true when draw calls can be batched together
+			bool IsBatchableWith(const SortingDrawCall& other) const;
+
+			bool operator==(const SortingDrawCall& other) const;
+		};
+
 	public:
 		PROPERTIES(Render);
 		PROPERTY(Camera, camera, SetCamera, GetCamera);                          // Current camera property
@@ -101,6 +125,27 @@ namespace o2
 		// Returns draw calls count at last frame
 		int GetDrawCallsCount();
 
+		// Returns drawn triangles count at last frame
+		int GetTrianglesCount();
+
+		// Returns texture switches count at last frame
+		int GetTextureSwitchesCount();
+
+		// Returns scissor rectangle changes count at last frame
+		int GetScissorChangesCount();
+
+		// Returns count of draw calls saved by draws sorting at last frame
+		int GetSortingSavedDrawCallsCount();
+
+		// Sets batch capacity in vertices and indexes. Flushes current batch. Limited by 65535 without 32 bit indexes
+		void SetBatchCapacity(UInt verticesCount, UInt indexesCount);
+
+		// Returns maximum vertices count in one batch
+		UInt GetBatchVerticesCapacity() const;
+
+		// Returns maximum indexes count in one batch
+		UInt GetBatchIndexesCapacity() const;
+
 		// Binding camera. NULL - standard camera
 		void SetCamera(const Camera& camera);
 
@@ -241,7 +286,20 @@ namespace o2
 
 		// Draws data from buffer with specified texture and primitive type
 		void DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-						UInt16* indexes, UInt elementsCount, const TextureRef& texture);
+						VertexIndex* indexes, UInt elementsCount, const TextureRef& texture);
+
+		// Begins draws sorting: next draws are deferred and reordered by texture and primitive type before submission,
+		// but not overlapping draws keep their order. Can be nested
+		void BeginDrawsSorting();
+
+		// Ends draws sorting. Outermost ending submits deferred draws
+		void EndDrawsSorting();
+
+		// Returns true when draws are sorting
+		bool IsDrawsSorting() const;
+
+		// Draws textured quads. Quads are expanded on GPU when instancing is available, otherwise on CPU
+		void DrawQuadInstances(const QuadInstance* instances, UInt count, const TextureRef& texture);
 
 		// Draws mesh wire
 		void DrawMeshWire(Mesh* mesh, const Color4& color = Color4::White());
@@ -274,6 +332,12 @@ namespace o2
 		// Returns scissor infos at current frame
 		const Vector<ScissorInfo>& GetScissorInfos() const;
 
+		// Returns loaded texture by source file name, or null
+		Texture* FindTexture(const String& fileName) const;
+
+		// Returns loaded atlas page texture, or null
+		Texture* FindTexture(const UID& atlasAssetId, int page) const;
+
 	protected:
 		PrimitiveType mCurrentPrimitiveType; // Type of drawing primitives for next DIP
 
@@ -283,12 +347,19 @@ namespace o2
 		UInt     mTrianglesCount;            // Triangles count for next DIP
 		UInt     mFrameTrianglesCount;       // Total triangles at current frame
 		UInt     mDIPCount;                  // DrawIndexedPrimitives calls count
+		UInt     mTextureSwitchesCount;      // Texture changes between DIPs count
+		UInt     mScissorChangesCount;       // Scissor rectangle changes count
 
 		LogStream* mLog; // Render log stream
 
 		Vector<Texture*> mTextures; // Loaded textures
 		Vector<Font*>    mFonts;    // Loaded fonts
 
+		std::unordered_map<UInt64, Texture*> mTexturesByFileName;  // Loaded textures by file name hash
+		std::unordered_map<UInt64, Texture*> mTexturesByAtlasPage; // Loaded textures by atlas id and page hash
+
+		Vector<Texture*> mTexturesUnloadingCandidates; // Textures, that had zero references since last unloading check
+
 		Camera mCamera;            // Camera transformation
 		Vec2I  mResolution;        // Primary back buffer size
 		Vec2I  mCurrentResolution; // Current back buffer size
@@ -314,9 +385,24 @@ namespace o2
 
 		Vector<Sprite*> mSprites; // All sprites
 
-		UInt16*    mHardLinesIndexData; // Index data buffer
-		TextureRef mSolidLineTexture;   // Solid line texture
-		TextureRef mDashLineTexture;    // Dash line texture
+		VertexIndex* mHardLinesIndexData; // Index data buffer
+		TextureRef   mSolidLineTexture;   // Solid line texture
+		TextureRef   mDashLineTexture;    // Dash line texture
+
+		VertexIndex*    mQuadsIndexData; // Indexes of quads expanded on CPU
+		Vector<Vertex2> mQuadsVertices;  // Vertices of quads expanded on CPU
+
+		int                     mDrawsSortingDepth = 0;         // Nesting level of draws sorting. Draws are deferred when above zero
+		bool                    mSubmittingSortedDraws = false; // True when deferred draws are submitting
+		Vector<SortingDrawCall> mSortingDrawCalls;              // Deferred draw calls
+		Vector<Vertex2>         mSortingVertices;               // Deferred draw calls vertices
+		Vector<VertexIndex>     mSortingIndexes;                // Deferred draw calls indexes
+		UInt                    mSortingSavedDIPsCount = 0;     // Draw calls saved by draws sorting
+
+		static const UInt mMaxBatchIndexValue = RENDER_32BIT_INDEXES ? UINT_MAX : USHRT_MAX; // Maximum vertices count addressable by index
+		static const UInt mMaxBatchIndexesCount = UINT_MAX/sizeof(VertexIndex);                // Maximum indexes count, keeps index buffer size in bytes within UInt
+		static const UInt mDefaultBatchVerticesCapacity = RENDER_32BIT_INDEXES ? 1 << 18 : USHRT_MAX; // Default batch vertices capacity
+		static const UInt mDefaultBatchIndexesCapacity = RENDER_32BIT_INDEXES ? 3 << 18 : USHRT_MAX;  // Default batch indexes capacity
 
 		bool mReady; // True, if render system initialized
 
@@ -330,6 +416,26 @@ namespace o2
 		// Initializes index buffer for drawing lines - pairs of lines beginnings and ends
 		void InitializeLinesIndexBuffer();
 
+		// Initializes index buffer for drawing quads expanded on CPU
+		void InitializeQuadsIndexBuffer();
+
+		// Expands quads into vertices on CPU and draws them as polygons
+		void DrawQuadInstancesExpanded(const QuadInstance* instances, UInt count, const TextureRef& texture);
+
+		// Checks that batch can hold specified vertices and indexes. Grows capacity in 32 bit indexes mode, 
+		// returns false when can't draw
+		bool CheckBatchCapacity(UInt verticesCount, UInt indexesCount);
+
+		// Recreates platform batch buffers after capacity changing
+		void OnBatchCapacityChanged();
+
+		// Stores draw call into deferred draws
+		void AddSortingDrawCall(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+								VertexIndex* indexes, UInt elementsCount, const TextureRef& texture);
+
+		// Reorders deferred draws by texture and primitive type and submits them
+		void SubmitSortedDraws();
+
 		// Initializeslines textures
 		void InitializeLinesTextures();
 
@@ -357,9 +463,30 @@ namespace o2
 		// Checks render compatibles
 		void CheckCompatibles();
 
-		// Check textures for unloading
+		// Adds texture to loaded textures and indices, texture is unloading candidate until it gets reference
+		void AddTexture(Texture* texture);
+
+		// Removes texture from loaded textures, indices and unloading candidates
+		void RemoveTexture(Texture* texture);
+
+		// Adds texture to indices by file name and atlas page
+		void IndexTexture(Texture* texture);
+
+		// Removes texture from indices by file name and atlas page
+		void UnindexTexture(Texture* texture);
+
+		// Adds texture without references to unloading candidates
+		void AddTextureUnloadingCandidate(Texture* texture);
+
+		// Check textures for unloading. Checks only textures, that lost all references since last check
 		void CheckTexturesUnloading();
 
+		// Returns texture file name index key
+		static UInt64 GetTextureKey(const String& fileName);
+
+		// Returns texture atlas page index key
+		static UInt64 GetTextureKey(const UID& atlasAssetId, int page);
+
 		// Checks font for unloading
 		void CheckFontsUnloading();
 
@@ -367,6 +494,7 @@ namespace o2
 		void OnAssetsRebuilded(const Vector<UID>& changedAssets);
 
 		friend class Application;
+		friend class AssetsLoader;
 		friend class BitmapFont;
 		friend class BitmapFontAsset;
 		friend class Font;
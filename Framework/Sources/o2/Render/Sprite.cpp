@@ -99,8 +99,8 @@ namespace o2
 	Sprite::Sprite(const Sprite& other):
 		mImageAsset(other.mImageAsset), mTextureSrcRect(other.mTextureSrcRect), IRectDrawable(other), 
 		mMesh(mnew Mesh(*other.mMesh)), mMode(other.mMode), mFill(other.mFill), mSlices(other.mSlices),
-		mMeshBuildFunc(other.mMeshBuildFunc), mTileScale(other.mTileScale),
-		texture(this), textureSrcRect(this), image(this), imageName(this), leftTopColor(this), rightTopColor(this),
+		mMeshBuildFunc(other.mMeshBuildFunc), mTileScale(other.mTileScale), mQuadInstance(other.mQuadInstance),
+		mIsQuad(other.mIsQuad), texture(this), textureSrcRect(this), image(this), imageName(this), leftTopColor(this), rightTopColor(this),
 		leftBottomColor(this), rightBottomColor(this), mode(this), fill(this), tileScale(this), sliceBorder(this), 
 		bitmap(this)
 	{
@@ -128,6 +128,8 @@ namespace o2
 		mSlices         = other.mSlices;
 		mTileScale      = other.mTileScale;
 		mMeshBuildFunc  = other.mMeshBuildFunc;
+		mQuadInstance   = other.mQuadInstance;
+		mIsQuad         = other.mIsQuad;
 		IRectDrawable::operator=(other);
 
 		return *this;
@@ -138,7 +140,11 @@ namespace o2
 		if (!mEnabled)
 			return;
 
-		mMesh->Draw();
+		if (mIsQuad)
+			o2Render.DrawQuadInstances(&mQuadInstance, 1, mMesh->mTexture);
+		else
+			mMesh->Draw();
+
 		OnDrawn();
 
 		if (o2Input.IsKeyDown(VK_F3))
@@ -436,6 +442,7 @@ namespace o2
 
 	void Sprite::UpdateMesh()
 	{
+		mIsQuad = false;
 		(this->*mMeshBuildFunc)();
 	}
 
@@ -449,7 +456,7 @@ namespace o2
 		for (int i = 0; i < 4; i++)
 			rcc[i] = (mColor*mCornersColors[i]).ABGR();
 
-		static UInt16 indexes[] ={ 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] ={ 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = mTextureSrcRect.left*invTexSize.x;
 		float uvRight = mTextureSrcRect.right*invTexSize.x;
@@ -462,10 +469,14 @@ namespace o2
 		mMesh->vertices[2].Set(mTransform.origin + mTransform.xv, rcc[2], uvRight, uvDown);
 		mMesh->vertices[3].Set(mTransform.origin, rcc[3], uvLeft, uvDown);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
+
+		mIsQuad = rcc[0] == rcc[1] && rcc[0] == rcc[2] && rcc[0] == rcc[3];
+		if (mIsQuad)
+			mQuadInstance.Set(mTransform, uvLeft, uvUp, uvRight, uvDown, rcc[0]);
 	}
 
 	void Sprite::BuildSlicedMesh()
@@ -484,7 +495,7 @@ namespace o2
 		for (int i = 0; i < 4; i++)
 			rcc[i] = (mColor*mCornersColors[i]).ABGR();
 
-		static UInt16 indexes[] ={
+		static VertexIndex indexes[] ={
 			0, 1, 5,    0, 5, 4,    1, 2, 6,    1, 6, 5,    2, 3, 7,    2, 7, 6,
 			4, 5, 9,    4, 9, 8,    5, 6, 10,   5, 10, 9,   6, 7, 11,   6, 11, 10,
 			8, 9, 13,   8, 13, 12,  9, 10, 14,  9, 14, 13,  10, 11, 15, 10, 15, 14
@@ -557,7 +568,7 @@ namespace o2
 		mMesh->vertices[14].Set(o      + r2, rcc[2], u2, v0);
 		mMesh->vertices[15].Set(o      + r3, rcc[2], u3, v0);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*18*3);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*18*3);
 
 		mMesh->vertexCount = 16;
 		mMesh->polyCount = 18;
@@ -658,7 +669,7 @@ namespace o2
 		for (int i = 0; i < 4; i++)
 			rcc[i] = (mColor*mCornersColors[i]).ABGR();
 
-		static UInt16 indexes[] = { 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] = { 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = mTextureSrcRect.left*invTexSize.x;
 		float uvRight = mTextureSrcRect.right*invTexSize.x;
@@ -689,7 +700,7 @@ namespace o2
 			mMesh->vertices[3].Set(mTransform.origin + offy, rcc[3], uvLeft, uvDown);
 		}
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
@@ -709,7 +720,7 @@ namespace o2
 		rcc[2] = (mColor*Math::Lerp(mCornersColors[3], mCornersColors[2], coef)).ABGR();
 		rcc[3] = (mColor*mCornersColors[3]).ABGR();
 
-		static UInt16 indexes[] ={ 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] ={ 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = mTextureSrcRect.left*invTexSize.x;
 		float uvRight = Math::Lerp((float)mTextureSrcRect.left, (float)mTextureSrcRect.right, coef)*invTexSize.x;
@@ -722,7 +733,7 @@ namespace o2
 		mMesh->vertices[2].Set(mTransform.origin + mTransform.xv*coef, rcc[2], uvRight, uvDown);
 		mMesh->vertices[3].Set(mTransform.origin, rcc[3], uvLeft, uvDown);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
@@ -743,7 +754,7 @@ namespace o2
 		rcc[2] = (mColor*mCornersColors[2]).ABGR();
 		rcc[3] = (mColor*Math::Lerp(mCornersColors[2], mCornersColors[3], coef)).ABGR();
 
-		static UInt16 indexes[] ={ 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] ={ 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = Math::Lerp((float)mTextureSrcRect.right, (float)mTextureSrcRect.left, coef)*invTexSize.x;
 		float uvRight = mTextureSrcRect.right*invTexSize.x;
@@ -756,7 +767,7 @@ namespace o2
 		mMesh->vertices[2].Set(mTransform.origin + mTransform.xv, rcc[2], uvRight, uvDown);
 		mMesh->vertices[3].Set(mTransform.origin + mTransform.xv*invCoef, rcc[3], uvLeft, uvDown);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
@@ -777,7 +788,7 @@ namespace o2
 		rcc[2] = (mColor*Math::Lerp(mCornersColors[1], mCornersColors[2], coef)).ABGR();
 		rcc[3] = (mColor*Math::Lerp(mCornersColors[0], mCornersColors[3], coef)).ABGR();
 
-		static UInt16 indexes[] ={ 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] ={ 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = mTextureSrcRect.left*invTexSize.x;
 		float uvRight = mTextureSrcRect.right*invTexSize.x;
@@ -790,7 +801,7 @@ namespace o2
 		mMesh->vertices[2].Set(mTransform.origin + mTransform.xv + mTransform.yv*invCoef, rcc[2], uvRight, uvDown);
 		mMesh->vertices[3].Set(mTransform.origin + mTransform.yv*invCoef, rcc[3], uvLeft, uvDown);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
@@ -810,7 +821,7 @@ namespace o2
 		rcc[2] = (mColor*mCornersColors[2]).ABGR();
 		rcc[3] = (mColor*mCornersColors[3]).ABGR();
 
-		static UInt16 indexes[] ={ 0, 1, 2, 0, 2, 3 };
+		static VertexIndex indexes[] ={ 0, 1, 2, 0, 2, 3 };
 
 		float uvLeft = mTextureSrcRect.left*invTexSize.x;
 		float uvRight = mTextureSrcRect.right*invTexSize.x;
@@ -823,7 +834,7 @@ namespace o2
 		mMesh->vertices[2].Set(mTransform.origin + mTransform.xv, rcc[2], uvRight, uvDown);
 		mMesh->vertices[3].Set(mTransform.origin, rcc[3], uvLeft, uvDown);
 
-		memcpy(mMesh->indexes, indexes, sizeof(UInt16)*6);
+		memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*6);
 
 		mMesh->vertexCount = 4;
 		mMesh->polyCount = 2;
@@ -869,8 +880,8 @@ namespace o2
 			mMesh->vertices[1].Set(dirPoint, dirColor, uDir, vUp);
 			mMesh->vertices[2].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 0, 1, 2 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3);
+			static VertexIndex indexes[] ={ 0, 1, 2 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3);
 
 			mMesh->vertexCount = 3;
 			mMesh->polyCount = 1;
@@ -889,8 +900,8 @@ namespace o2
 			mMesh->vertices[2].Set(dirPoint, dirColor, uRight, vDir);
 			mMesh->vertices[3].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 0, 1, 3, 1, 2, 3 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*2);
+			static VertexIndex indexes[] ={ 0, 1, 3, 1, 2, 3 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*2);
 
 			mMesh->vertexCount = 4;
 			mMesh->polyCount = 2;
@@ -911,8 +922,8 @@ namespace o2
 			mMesh->vertices[3].Set(dirPoint, dirColor, uDir, vDown);
 			mMesh->vertices[4].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 0, 1, 4, 1, 2, 4, 2, 3, 4 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*3);
+			static VertexIndex indexes[] ={ 0, 1, 4, 1, 2, 4, 2, 3, 4 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*3);
 
 			mMesh->vertexCount = 5;
 			mMesh->polyCount = 3;
@@ -935,8 +946,8 @@ namespace o2
 			mMesh->vertices[4].Set(dirPoint, dirColor, uLeft, vDir);
 			mMesh->vertices[5].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 0, 1, 5, 1, 2, 5, 2, 3, 5, 3, 4, 5 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*4);
+			static VertexIndex indexes[] ={ 0, 1, 5, 1, 2, 5, 2, 3, 5, 3, 4, 5 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*4);
 
 			mMesh->vertexCount = 6;
 			mMesh->polyCount = 4;
@@ -961,8 +972,8 @@ namespace o2
 			mMesh->vertices[5].Set(dirPoint, dirColor, uDir, vUp);
 			mMesh->vertices[6].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 0, 1, 6, 1, 2, 6, 2, 3, 6, 3, 4, 6, 4, 5, 6 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*5);
+			static VertexIndex indexes[] ={ 0, 1, 6, 1, 2, 6, 2, 3, 6, 3, 4, 6, 4, 5, 6 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*5);
 
 			mMesh->vertexCount = 7;
 			mMesh->polyCount = 5;
@@ -1009,8 +1020,8 @@ namespace o2
 			mMesh->vertices[1].Set(dirPoint, dirColor, uDir, vUp);
 			mMesh->vertices[2].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 1, 0, 2 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3);
+			static VertexIndex indexes[] ={ 1, 0, 2 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3);
 
 			mMesh->vertexCount = 3;
 			mMesh->polyCount = 1;
@@ -1029,8 +1040,8 @@ namespace o2
 			mMesh->vertices[2].Set(dirPoint, dirColor, uLeft, vDir);
 			mMesh->vertices[3].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 1, 0, 3, 2, 1, 3 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*2);
+			static VertexIndex indexes[] ={ 1, 0, 3, 2, 1, 3 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*2);
 
 			mMesh->vertexCount = 4;
 			mMesh->polyCount = 2;
@@ -1051,8 +1062,8 @@ namespace o2
 			mMesh->vertices[3].Set(dirPoint, dirColor, uDir, vDown);
 			mMesh->vertices[4].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 1, 0, 4, 2, 1, 4, 3, 2, 4 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*3);
+			static VertexIndex indexes[] ={ 1, 0, 4, 2, 1, 4, 3, 2, 4 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*3);
 
 			mMesh->vertexCount = 5;
 			mMesh->polyCount = 3;
@@ -1075,8 +1086,8 @@ namespace o2
 			mMesh->vertices[4].Set(dirPoint, dirColor, uRight, vDir);
 			mMesh->vertices[5].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 1, 0, 5, 2, 1, 5, 3, 2, 5, 4, 3, 5 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*4);
+			static VertexIndex indexes[] ={ 1, 0, 5, 2, 1, 5, 3, 2, 5, 4, 3, 5 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*4);
 
 			mMesh->vertexCount = 6;
 			mMesh->polyCount = 4;
@@ -1101,8 +1112,8 @@ namespace o2
 			mMesh->vertices[5].Set(dirPoint, dirColor, uDir, vUp);
 			mMesh->vertices[6].Set(centerPos, centerResColr, uCenter, vCenter);
 
-			static UInt16 indexes[] ={ 1, 0, 6, 2, 1, 6, 3, 2, 6, 4, 3, 6, 5, 4, 6 };
-			memcpy(mMesh->indexes, indexes, sizeof(UInt16)*3*5);
+			static VertexIndex indexes[] ={ 1, 0, 6, 2, 1, 6, 3, 2, 6, 4, 3, 6, 5, 4, 6 };
+			memcpy(mMesh->indexes, indexes, sizeof(VertexIndex)*3*5);
 
 			mMesh->vertexCount = 7;
 			mMesh->polyCount = 5;
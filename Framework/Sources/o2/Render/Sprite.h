@@ -2,6 +2,7 @@
 
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Render/Mesh.h"
+#include "o2/Render/QuadInstance.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Border.h"
@@ -199,6 +200,8 @@ namespace o2
 		float         mFill = 1.0f;                // Sprite fillness @SERIALIZABLE
 		float         mTileScale = 1.0f;           // Scale of tiles in tiled mode. 1.0f is default and equals to default image size @SERIALIZABLE
 		Mesh*         mMesh;                       // Drawing mesh
+		QuadInstance  mQuadInstance;               // Drawing quad, used instead of mesh when sprite is single colored quad
+		bool          mIsQuad = false;             // True when sprite is drawing as quad instance
 
 		void(Sprite::*mMeshBuildFunc)(); // Mesh building function pointer (by mode)
 
@@ -277,6 +280,8 @@ CLASS_FIELDS_META(o2::Sprite)
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1.0f).NAME(mFill).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1.0f).NAME(mTileScale).PROTECTED();
 	FIELD().NAME(mMesh).PROTECTED();
+	FIELD().NAME(mQuadInstance).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mIsQuad).PROTECTED();
 }
 END_META;
 CLASS_METHODS_META(o2::Sprite)
@@ -201,6 +201,9 @@ namespace o2
 
 	void Text::SetHorAlign(HorAlign align)
 	{
+		if (mHorAlign == align)
+			return;
+
 		mHorAlign = align;
 		UpdateMesh();
 	}
@@ -212,6 +215,9 @@ namespace o2
 
 	void Text::SetVerAlign(VerAlign align)
 	{
+		if (mVerAlign == align)
+			return;
+
 		mVerAlign = align;
 		UpdateMesh();
 	}
@@ -223,6 +229,9 @@ namespace o2
 
 	void Text::SetWordWrap(bool flag)
 	{
+		if (mWordWrap == flag)
+			return;
+
 		mWordWrap = flag;
 		UpdateMesh();
 	}
@@ -234,6 +243,9 @@ namespace o2
 
 	void Text::SetDotsEngings(bool flag)
 	{
+		if (mDotsEndings == flag)
+			return;
+
 		mDotsEndings = flag;
 		UpdateMesh();
 	}
@@ -245,6 +257,9 @@ namespace o2
 
 	void Text::SetSymbolsDistanceCoef(float coef)
 	{
+		if (mSymbolsDistCoef == coef)
+			return;
+
 		mSymbolsDistCoef = coef;
 		UpdateMesh();
 	}
@@ -256,6 +271,9 @@ namespace o2
 
 	void Text::SetLinesDistanceCoef(float coef /*= 1*/)
 	{
+		if (mLinesDistanceCoef == coef)
+			return;
+
 		mLinesDistanceCoef = coef;
 		UpdateMesh();
 	}
@@ -320,31 +338,75 @@ namespace o2
 			return;
 		}
 
-		PrepareMesh(textLen);
+		int beginSymbol = 0;
+		if (mSymbolsSet.CanAppend(mFont, mText, mHeight, mTransform.origin, mSize, mHorAlign, mVerAlign, mWordWrap, mDotsEndings,
+								  mSymbolsDistCoef, mLinesDistanceCoef))
+		{
+			beginSymbol = mSymbolsSet.Append(mText);
+		}
+		else
+		{
+			mSymbolsSet.Initialize(mFont, mText, mHeight, mTransform.origin, mSize, mHorAlign, mVerAlign, mWordWrap, mDotsEndings,
+								   mSymbolsDistCoef, mLinesDistanceCoef);
+		}
+
+		Basis transf = CalculateTextBasis();
+
+		// Vertices of kept symbols are valid only when meshes weren't reallocated and transformation is same
+		if (PrepareMesh(textLen) || transf != mLastTransform)
+			beginSymbol = 0;
 
+		mLastTransform = transf;
+
+		UpdateMeshVertices(beginSymbol, transf);
+
+		mUpdatingMesh = false;
+	}
+
+	void Text::UpdateMeshVertices(int beginSymbol, const Basis& transf)
+	{
+		// Each mesh is filled up by symbols, so mesh with begin symbol is found by meshes capacities
+		int currentMeshIdx = 0;
+		int skipSymbols = beginSymbol;
 		for (auto mesh : mMeshes)
 		{
-			mesh->vertexCount = 0;
-			mesh->polyCount = 0;
+			int meshSymbols = mesh->GetMaxPolyCount()/2;
+			if (skipSymbols < meshSymbols)
+				break;
+
+			skipSymbols -= meshSymbols;
+			currentMeshIdx++;
 		}
 
-		int currentMeshIdx = 0;
-		Mesh* currentMesh = mMeshes[0];
+		for (int i = currentMeshIdx; i < mMeshes.Count(); i++)
+		{
+			mMeshes[i]->vertexCount = 0;
+			mMeshes[i]->polyCount = 0;
+		}
 
-		mSymbolsSet.Initialize(mFont, mText, mHeight, mTransform.origin, mSize, mHorAlign, mVerAlign, mWordWrap, mDotsEndings,
-							   mSymbolsDistCoef, mLinesDistanceCoef);
+		Mesh* currentMesh = mMeshes[currentMeshIdx];
+		currentMesh->vertexCount = skipSymbols*4;
+		currentMesh->polyCount = skipSymbols*2;
 
-		Basis transf = CalculateTextBasis();
-		mLastTransform = transf;
+		unsigned long color = mColor.ABGR();
+		int symbolIdx = 0;
 
 		for (auto& line : mSymbolsSet.mLines)
 		{
+			if (symbolIdx + line.mSymbols.Count() <= beginSymbol)
+			{
+				symbolIdx += line.mSymbols.Count();
+				continue;
+			}
+
 			for (auto& symb : line.mSymbols)
 			{
-				if (currentMesh->polyCount + 2 >= currentMesh->GetMaxPolyCount())
-					currentMesh = mMeshes[currentMeshIdx++];
+				if (symbolIdx++ < beginSymbol)
+					continue;
+
+				if (currentMesh->polyCount + 2 > currentMesh->GetMaxPolyCount())
+					currentMesh = mMeshes[++currentMeshIdx];
 
-				unsigned long color = mColor.ABGR();
 				Vec2F points[4] =
 				{
 					transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
@@ -372,33 +434,39 @@ namespace o2
 			}
 		}
 
-		currentMesh->SetTexture(mFont->mTexture);
-
-		mUpdatingMesh = false;
+		for (auto mesh : mMeshes)
+			mesh->SetTexture(mFont->mTexture);
 	}
 
 	void Text::CheckCharactersAndRebuildMesh()
 	{
 		mFont->CheckCharacters(mText, height);
 		mFont->CheckCharacters(".", height);
+
+		// Characters could be rebuilt in other places of font texture, so layout isn't reused
+		mSymbolsSet.mLines.Clear();
 		UpdateMesh();
 	}
 
-	void Text::PrepareMesh(int charactersCount)
+	bool Text::PrepareMesh(int charactersCount)
 	{
 		int needPolygons = charactersCount*2 + 15; // 15 for dots endings
 		for (auto mesh : mMeshes)
 			needPolygons -= mesh->GetMaxPolyCount();
 
 		if (needPolygons <= 0)
-			return;
+			return false;
+
+		// Meshes are grown with reserve, so appending text doesn't reallocate them every time
+		if (mMeshes.Count() > 0)
+			needPolygons = Math::Max<int>(needPolygons, mMeshes.Last()->GetMaxPolyCount()/2);
 
 		if (mMeshes.Count() > 0 &&
 			needPolygons + mMeshes.Last()->GetMaxPolyCount() < mMeshMaxPolyCount)
 		{
 			mMeshes.Last()->Resize(mMeshes.Last()->GetMaxVertexCount() + (UInt)needPolygons*2,
 								   mMeshes.Last()->GetMaxPolyCount() + (UInt)needPolygons);
-			return;
+			return true;
 		}
 
 		while (needPolygons > 0)
@@ -407,6 +475,8 @@ namespace o2
 			needPolygons -= polyCount;
 			mMeshes.Add(mnew Mesh(mFont->mTexture, polyCount * 2, polyCount));
 		}
+
+		return true;
 	}
 
 	Basis Text::CalculateTextBasis() const
@@ -493,24 +563,71 @@ namespace o2
 		mDotsEndings = dotsEngings;
 
 		mLines.Clear();
-		int textLen = mText.Length();
 
-		if (textLen == 0)
+		if (mText.Length() == 0)
 			return;
 
+		LayoutSymbols(0);
+		ArrangeLines(0);
+	}
+
+	bool Text::SymbolsSet::CanAppend(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
+									 HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings,
+									 float charsDistCoef, float linesDistCoef) const
+	{
+		// With other vertical aligns lines positions depend on lines count, so all lines are moved when text grows
+		if (verAlign != VerAlign::Top || mLines.IsEmpty())
+			return false;
+
+		if (!(mFont == font) || mHeight != height || mAreaSize != areaSize || mHorAlign != horAlign || mVerAlign != verAlign ||
+			mWordWrap != wordWrap || mDotsEndings != dotsEngings || mSymbolsDistCoef != charsDistCoef ||
+			mLinesDistCoef != linesDistCoef)
+		{
+			return false;
+		}
+
+		if (mPosition != Vec2F(Math::Round(position.x), Math::Round(position.y)))
+			return false;
+
+		return text.StartsWith(mText);
+	}
+
+	int Text::SymbolsSet::Append(const WString& text)
+	{
+		// Last line can be wrapped differently with new text, so it is laid out again
+		int lastLineBegin = mLines.Last().mLineBegSymbol;
+		mLines.PopBack();
+
+		int keptSymbolsCount = 0;
+		for (auto& line : mLines)
+			keptSymbolsCount += line.mSymbols.Count();
+
+		int beginLine = mLines.Count();
+		mText = text;
+
+		LayoutSymbols(lastLineBegin);
+		ArrangeLines(beginLine);
+
+		return keptSymbolsCount;
+	}
+
+	void Text::SymbolsSet::LayoutSymbols(int begin)
+	{
+		int textLen = mText.Length();
+
 		float linesDist = mFont->GetLineHeightPx(mHeight)*mLinesDistCoef;
 		float fontHeight = mFont->GetHeightPx(mHeight);
 
 		mLines.Add(Line());
 		Line* curLine = &mLines.Last();
-		curLine->mSize.y = fontHeight;
+		curLine->mSize.y = mLines.Count() == 1 ? fontHeight : linesDist;
+		curLine->mLineBegSymbol = begin;
 
 		float dotsSize = mFont->GetCharacter('.', mHeight).mAdvance*3.0f;
 
-		Vec2F fullSize(0, fontHeight);
 		bool checkAreaBounds = mWordWrap && mAreaSize.x > FLT_EPSILON;
 		int wrapCharIdx = -1;
-		for (int i = 0; i < textLen; i++)
+		for (int i = begin; i < textLen; i++)
 		{
 			const Font::Character& ch = mFont->GetCharacter(mText[i], mHeight);
 			Vec2F chSize = ch.mSize;
@@ -568,7 +685,6 @@ namespace o2
 						curLine->mSize.x = 0;
 
 					i = wrapCharIdx - 1;
-					wrapCharIdx = -1;
 				}
 				else
 				{
@@ -577,8 +693,8 @@ namespace o2
 					curLine->mEndedNewLine = true;
 				}
 
-				fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
-				fullSize.y += linesDist;
+				// Each line is laid out independently from previous lines, so tail lines can be laid out again
+				wrapCharIdx = -1;
 
 				mLines.Add(Line());
 				curLine = &mLines.Last();
@@ -591,8 +707,16 @@ namespace o2
 				wrapCharIdx = i;
 			}
 		}
+	}
 
-		fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
+	void Text::SymbolsSet::ArrangeLines(int beginLine)
+	{
+		float linesDist = mFont->GetLineHeightPx(mHeight)*mLinesDistCoef;
+		float fontHeight = mFont->GetHeightPx(mHeight);
+
+		Vec2F fullSize(0, fontHeight + linesDist*(float)(mLines.Count() - 1));
+		for (auto& line : mLines)
+			fullSize.x = Math::Max(fullSize.x, line.mSize.x);
 
 		float lineHeight = linesDist;
 		float yOffset = mAreaSize.y - mLines[0].mSize.y;
@@ -606,9 +730,12 @@ namespace o2
 
 		yOffset += mPosition.y;
 
-		for (Vector<Line>::Iterator it = mLines.begin(); it != mLines.end(); ++it)
+		for (int i = 0; i < beginLine; i++)
+			yOffset -= lineHeight;
+
+		for (int i = beginLine; i < mLines.Count(); i++)
 		{
-			Line* line = &(*it);
+			Line* line = &mLines[i];
 
 			float xOffset = 0;
 			float additiveSpaceOffs = 0;
@@ -647,6 +774,8 @@ namespace o2
 
 			line.mPosition += offs;
 		}
+
+		mPosition += offs;
 	}
 
 	Text::SymbolsSet::Symbol::Symbol()
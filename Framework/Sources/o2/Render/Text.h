@@ -219,13 +219,30 @@ namespace o2
 							HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, float charsDistCoef,
 							float linesDistCoef);
 
+			// Returns true when text can be laid out incrementally by Append(): parameters are same, new text begins with
+			// current text and lines positions don't depend on lines count
+			bool CanAppend(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
+						   HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, float charsDistCoef,
+						   float linesDistCoef) const;
+
+			// Lays out text, that begins with current text. Last line is laid out again with text tail, previous lines
+			// are kept. Returns count of kept symbols
+			int Append(const WString& text);
+
 			// Moves symbols 
 			void Move(const Vec2F& offs);
+
+		protected:
+			// Lays out symbols from text index to end into new lines
+			void LayoutSymbols(int begin);
+
+			// Aligns lines from index and calculates real size
+			void ArrangeLines(int beginLine);
 		};
 
 	protected:
 		static const char* mBasicSymbolsPreset;
-		const UInt mMeshMaxPolyCount = 4096;
+		const UInt mMeshMaxPolyCount = RENDER_32BIT_INDEXES ? 65536 : 4096;
 
 		WString  mText;              // Wide char string, containing rendering text @SERIALIZABLE
 		UID      mFontAssetId;       // Font asset id @SERIALIZABLE
@@ -246,17 +263,20 @@ namespace o2
 		bool mUpdatingMesh; // True, when mesh is already updating
 
 	protected:
-		// Updating meshes
+		// Updating meshes. Layout is reused when text is appended, vertices of not changed symbols are kept
 		void UpdateMesh();
 
+		// Writes vertices of symbols from index, vertices of previous symbols are kept
+		void UpdateMeshVertices(int beginSymbol, const Basis& transf);
+
 		// Checks test's characters in font and rebuilds mesh. Used when fond is resetting
 		void CheckCharactersAndRebuildMesh();
 
 		// Transforming meshes by basis
 		void TransformMesh(const Basis& bas);
 
-		// Preparing meshes for characters count
-		void PrepareMesh(int charactersCount);
+		// Preparing meshes for characters count. Returns true when meshes were reallocated
+		bool PrepareMesh(int charactersCount);
 
 		// Calculates and returns text basis
 		Basis CalculateTextBasis() const;
@@ -289,7 +309,7 @@ CLASS_FIELDS_META(o2::Text)
 	FIELD().NAME(dotsEngings).PUBLIC();
 	FIELD().NAME(symbolsDistanceCoef).PUBLIC();
 	FIELD().NAME(linesDistanceCoef).PUBLIC();
-	FIELD().DEFAULT_VALUE(4096).NAME(mMeshMaxPolyCount).PROTECTED();
+	FIELD().DEFAULT_VALUE(RENDER_32BIT_INDEXES ? 65536 : 4096).NAME(mMeshMaxPolyCount).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mText).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mFontAssetId).PROTECTED();
 	FIELD().NAME(mFont).PROTECTED();
@@ -335,9 +355,10 @@ CLASS_METHODS_META(o2::Text)
 	PUBLIC_FUNCTION(RectF, GetRealRect);
 	PUBLIC_STATIC_FUNCTION(Vec2F, GetTextSize, const WString&, Font*, int, const Vec2F&, HorAlign, VerAlign, bool, bool, float, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(void, UpdateMeshVertices, int, const Basis&);
 	PROTECTED_FUNCTION(void, CheckCharactersAndRebuildMesh);
 	PROTECTED_FUNCTION(void, TransformMesh, const Basis&);
-	PROTECTED_FUNCTION(void, PrepareMesh, int);
+	PROTECTED_FUNCTION(bool, PrepareMesh, int);
 	PROTECTED_FUNCTION(Basis, CalculateTextBasis);
 	PROTECTED_FUNCTION(void, ColorChanged);
 	PROTECTED_FUNCTION(void, BasisChanged);
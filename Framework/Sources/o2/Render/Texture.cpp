@@ -12,42 +12,42 @@ namespace o2
 	Texture::Texture() :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
-		o2Render.mTextures.Add(this);
+		o2Render.AddTexture(this);
 	}
 
 	Texture::Texture(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
+		o2Render.AddTexture(this);
 		Create(size, format, usage);
-		o2Render.mTextures.Add(this);
 	}
 
 	Texture::Texture(const String& fileName) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
+		o2Render.AddTexture(this);
 		Create(fileName);
-		o2Render.mTextures.Add(this);
 	}
 
 	Texture::Texture(Bitmap* bitmap) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
+		o2Render.AddTexture(this);
 		Create(bitmap);
-		o2Render.mTextures.Add(this);
 	}
 
 	Texture::Texture(UID atlasAssetId, int page) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
+		o2Render.AddTexture(this);
 		Create(atlasAssetId, page);
-		o2Render.mTextures.Add(this);
 	}
 
 	Texture::Texture(const String& atlasAssetName, int page) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
+		o2Render.AddTexture(this);
 		Create(atlasAssetName, page);
-		o2Render.mTextures.Add(this);
 	}
 
 	void Texture::Create(const String& fileName)
@@ -55,7 +55,7 @@ namespace o2
 		Bitmap* image = mnew Bitmap();
 		if (image->Load(fileName, Bitmap::ImageType::Auto))
 		{
-			mFileName = fileName;
+			SetSource(fileName, mAtlasAssetId, mAtlasPage);
 			Create(image);
 		}
 
@@ -63,13 +63,19 @@ namespace o2
 		mReady = true;
 	}
 
+	void Texture::Create(const String& fileName, Bitmap* bitmap, UID atlasAssetId /*= 0*/, int atlasPage /*= -1*/)
+	{
+		SetSource(fileName, atlasAssetId, atlasPage);
+		Create(bitmap);
+		mReady = true;
+	}
+
 	void Texture::Create(UID atlasAssetId, int page)
 	{
 		auto& info = o2Assets.GetAssetInfo(atlasAssetId);
 		if (info.IsValid())
 		{
-			mAtlasAssetId = atlasAssetId;
-			mAtlasPage = page;
+			SetSource(mFileName, atlasAssetId, page);
 			String textureFileName = AtlasAsset::GetPageTextureFileName(info, page);
 			Create(textureFileName);
 
@@ -83,8 +89,7 @@ namespace o2
 		auto& info = o2Assets.GetAssetInfo(atlasAssetName);
 		if (info.IsValid())
 		{
-			mAtlasAssetId = o2Assets.GetAssetId(atlasAssetName);
-			mAtlasPage = page;
+			SetSource(mFileName, o2Assets.GetAssetId(atlasAssetName), page);
 			String textureFileName = AtlasAsset::GetPageTextureFileName(info, page);
 			Create(textureFileName);
 
@@ -138,6 +143,30 @@ namespace o2
 	{
 		return mAtlasPage;
 	}
+
+	void Texture::SetSource(const String& fileName, UID atlasAssetId, int atlasPage)
+	{
+		o2Render.UnindexTexture(this);
+
+		mFileName = fileName;
+		mAtlasAssetId = atlasAssetId;
+		mAtlasPage = atlasPage;
+
+		o2Render.IndexTexture(this);
+	}
+
+	void Texture::IncreaseRefs()
+	{
+		mRefs++;
+	}
+
+	void Texture::DecreaseRefs()
+	{
+		mRefs--;
+
+		if (mRefs == 0)
+			o2Render.AddTextureUnloadingCandidate(this);
+	}
 }
 
 ENUM_META(o2::Texture::Usage)
@@ -1,6 +1,8 @@
 #pragma once
 
-#if defined PLATFORM_WINDOWS
+#if defined O2_HEADLESS || defined PLATFORM_LINUX
+#include "o2/Render/Headless/TextureBase.h"
+#elif defined PLATFORM_WINDOWS
 #include "o2/Render/Windows/TextureBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/TextureBase.h"
@@ -72,6 +74,9 @@ namespace o2
 		// Creates texture from bitmap
 		void Create(Bitmap* bitmap);
 
+		// Creates texture from bitmap, decoded from file or atlas page file. Used when file is decoded asynchronously
+		void Create(const String& fileName, Bitmap* bitmap, UID atlasAssetId = 0, int atlasPage = -1);
+
 		// Sets texture's data from bitmap
 		void SetData(Bitmap* bitmap);
 
@@ -127,7 +132,19 @@ namespace o2
 		int         mAtlasPage;               // Atlas page
 		bool        mReady;                   // Is texture ready to use
 
-		int mRefs = 0; // Texture references
+		int  mRefs = 0;                   // Texture references
+		int  mRenderIndex = -1;           // Index in render loaded textures list
+		bool mUnloadingCandidate = false; // Is texture in render unloading candidates list
+
+	protected:
+		// Sets source file name and atlas page, updates render textures indices
+		void SetSource(const String& fileName, UID atlasAssetId, int atlasPage);
+
+		// Increases references count
+		void IncreaseRefs();
+
+		// Decreases references count, texture becomes unloading candidate when there is no references
+		void DecreaseRefs();
 
 		friend class Render;
 		friend class TextureRef;
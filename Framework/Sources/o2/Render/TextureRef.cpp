@@ -17,49 +17,47 @@ namespace o2
 						   Texture::Usage usage /*= Texture::Usage::Default*/)
 	{
 		mTexture = mnew Texture(size, format, usage);
-		mTexture->mRefs++;
+		mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(const String& fileName)
 	{
-		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) { return tex->GetFileName() == fileName; });
+		mTexture = o2Render.FindTexture(fileName);
 
 		if (!mTexture)
 			mTexture = mnew Texture(fileName);
 
-		mTexture->mRefs++;
+		mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(Bitmap* bitmap)
 	{
 		mTexture = mnew Texture(bitmap);
-		mTexture->mRefs++;
+		mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(const TextureRef& other):
 		mTexture(other.mTexture)
 	{
 		if (mTexture)
-			mTexture->mRefs++;
+			mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(Texture* texture):
 		mTexture(texture)
 	{
 		if (mTexture)
-			mTexture->mRefs++;
+			mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(UID atlasAssetId, int page)
 	{
-		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) {
-			return tex->GetAtlasAssetId() == atlasAssetId && tex->GetAtlasPage() == page;
-		});
+		mTexture = o2Render.FindTexture(atlasAssetId, page);
 
 		if (!mTexture)
 			mTexture = mnew Texture(atlasAssetId, page);
 
-		mTexture->mRefs++;
+		mTexture->IncreaseRefs();
 	}
 
 	TextureRef::TextureRef(const String& atlasAssetName, int page)
@@ -72,31 +70,29 @@ namespace o2
 			return;
 		}
 
-		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) {
-			return tex->GetAtlasAssetId() == atlasAssetId && tex->GetAtlasPage() == page;
-		});
+		mTexture = o2Render.FindTexture(atlasAssetId, page);
 
 		if (!mTexture)
 			mTexture = mnew Texture(atlasAssetId, page);
 
-		mTexture->mRefs++;
+		mTexture->IncreaseRefs();
 	}
 
 	TextureRef::~TextureRef()
 	{
 		if (mTexture)
-			mTexture->mRefs--;
+			mTexture->DecreaseRefs();
 	}
 
 	TextureRef& TextureRef::operator=(const TextureRef& other)
 	{
 		if (mTexture)
-			mTexture->mRefs--;
+			mTexture->DecreaseRefs();
 
 		mTexture = other.mTexture;
 
 		if (mTexture)
-			mTexture->mRefs++;
+			mTexture->IncreaseRefs();
 
 		return *this;
 	}
@@ -140,14 +140,8 @@ namespace o2
 
 		for (int i = 0; i < len; i++)
 		{
-			bool isNew = true;
 			wchar_t c = needChararacters[i];
-			auto fndHeight = mCharacters.find(height);
-			if (fndHeight != mCharacters.End())
-			{
-				auto fndId = fndHeight->second.find(c);
-				isNew = fndHeight->second.find(c) == fndHeight->second.End();
-			}
+			bool isNew = FindCharacter(c, height) == nullptr;
 
 			if (isNew)
 				isNew = !needToRenderChars.Contains(c);
@@ -202,7 +196,7 @@ namespace o2
 
 	void VectorFont::Reset()
 	{
-		mCharacters.Clear();
+		ClearCharacters();
 		onCharactersRebuilt();
 	}
 
@@ -296,14 +290,16 @@ namespace o2
 					mTexture = TextureRef(lastTexture->GetSize()*2, PixelFormat::R8G8B8A8, Texture::Usage::Default);
 					mTexture->Copy(*lastTexture.Get(), RectI(Vec2I(0, 0), lastTexture->GetSize()));
 
-					for (auto heightKV : mCharacters)
+					for (auto table : mCharactersTables)
 					{
-						for (auto charKV : heightKV.second)
+						for (auto& character : table->characters)
 						{
-							charKV.second.mTexSrc.left *= 0.5f;
-							charKV.second.mTexSrc.right *= 0.5f;
-							charKV.second.mTexSrc.top *= 0.5f;
-							charKV.second.mTexSrc.bottom *= 0.5f;
+							// Texture coordinates are u = x/width and v = 1 - y/height, previous texture is copied into first
+							// half of columns and rows
+							character.mTexSrc.left *= 0.5f;
+							character.mTexSrc.right *= 0.5f;
+							character.mTexSrc.top = 0.5f + character.mTexSrc.top*0.5f;
+							character.mTexSrc.bottom = 0.5f + character.mTexSrc.bottom*0.5f;
 						}
 					}
 				}
@@ -17,18 +17,89 @@ PROC GetSafeWGLProcAddress(const char* id, o2::LogStream* log)
 
 void GetGLExtensions(o2::LogStream* log /*= nullptr*/)
 {
-	glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)GetSafeWGLProcAddress("glGenFramebuffersEXT", log);
-	glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)GetSafeWGLProcAddress("glBindFramebufferEXT", log);
+	glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glGenFramebuffers", log);
+	glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)GetSafeWGLProcAddress("glBindFramebuffer", log);
 	glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)GetSafeWGLProcAddress("glFramebufferTexture", log);
 	glDrawBuffers = (PFNGLDRAWBUFFERSPROC)GetSafeWGLProcAddress("glDrawBuffers", log);
 	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteBuffers", log);
-	glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffersEXT", log);
-	glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)GetSafeWGLProcAddress("glCheckFramebufferStatusEXT", log);
+	glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffers", log);
+	glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)GetSafeWGLProcAddress("glCheckFramebufferStatus", log);
+
+	glGetStringi = (PFNGLGETSTRINGIPROC)GetSafeWGLProcAddress("glGetStringi", log);
+	glActiveTexture = (PFNGLACTIVETEXTUREPROC)GetSafeWGLProcAddress("glActiveTexture", log);
+	glGenBuffers = (PFNGLGENBUFFERSPROC)GetSafeWGLProcAddress("glGenBuffers", log);
+	glBindBuffer = (PFNGLBINDBUFFERPROC)GetSafeWGLProcAddress("glBindBuffer", log);
+	glBufferData = (PFNGLBUFFERDATAPROC)GetSafeWGLProcAddress("glBufferData", log);
+	glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)GetSafeWGLProcAddress("glMapBufferRange", log);
+	glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)GetSafeWGLProcAddress("glUnmapBuffer", log);
+	glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)GetSafeWGLProcAddress("glGenVertexArrays", log);
+	glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)GetSafeWGLProcAddress("glBindVertexArray", log);
+	glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)GetSafeWGLProcAddress("glDeleteVertexArrays", log);
+	glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)GetSafeWGLProcAddress("glVertexAttribPointer", log);
+	glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)GetSafeWGLProcAddress("glEnableVertexAttribArray", log);
+	glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)GetSafeWGLProcAddress("glDrawElementsBaseVertex", log);
+	glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)GetSafeWGLProcAddress("glVertexAttribDivisor", log);
+	glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)GetSafeWGLProcAddress("glDrawArraysInstanced", log);
+	glCreateShader = (PFNGLCREATESHADERPROC)GetSafeWGLProcAddress("glCreateShader", log);
+	glShaderSource = (PFNGLSHADERSOURCEPROC)GetSafeWGLProcAddress("glShaderSource", log);
+	glCompileShader = (PFNGLCOMPILESHADERPROC)GetSafeWGLProcAddress("glCompileShader", log);
+	glGetShaderiv = (PFNGLGETSHADERIVPROC)GetSafeWGLProcAddress("glGetShaderiv", log);
+	glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)GetSafeWGLProcAddress("glGetShaderInfoLog", log);
+	glDeleteShader = (PFNGLDELETESHADERPROC)GetSafeWGLProcAddress("glDeleteShader", log);
+	glCreateProgram = (PFNGLCREATEPROGRAMPROC)GetSafeWGLProcAddress("glCreateProgram", log);
+	glAttachShader = (PFNGLATTACHSHADERPROC)GetSafeWGLProcAddress("glAttachShader", log);
+	glLinkProgram = (PFNGLLINKPROGRAMPROC)GetSafeWGLProcAddress("glLinkProgram", log);
+	glGetProgramiv = (PFNGLGETPROGRAMIVPROC)GetSafeWGLProcAddress("glGetProgramiv", log);
+	glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)GetSafeWGLProcAddress("glGetProgramInfoLog", log);
+	glDeleteProgram = (PFNGLDELETEPROGRAMPROC)GetSafeWGLProcAddress("glDeleteProgram", log);
+	glUseProgram = (PFNGLUSEPROGRAMPROC)GetSafeWGLProcAddress("glUseProgram", log);
+	glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)GetSafeWGLProcAddress("glGetUniformLocation", log);
+	glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)GetSafeWGLProcAddress("glUniformMatrix4fv", log);
+	glUniform1i = (PFNGLUNIFORM1IPROC)GetSafeWGLProcAddress("glUniform1i", log);
+}
+
+HGLRC CreateGLCoreContext(HDC hdc, o2::LogStream* log /*= nullptr*/)
+{
+	auto wglCreateContextAttribsARB = (PFNWGLCREATECONTEXTATTRIBSARBPROC)wglGetProcAddress("wglCreateContextAttribsARB");
+	if (!wglCreateContextAttribsARB)
+	{
+		if (log)
+			log->Error("wglCreateContextAttribsARB isn't supported");
+
+		return NULL;
+	}
+
+	const int attributes[] =
+	{
+		WGL_CONTEXT_MAJOR_VERSION_ARB, 3,
+		WGL_CONTEXT_MINOR_VERSION_ARB, 3,
+		WGL_CONTEXT_PROFILE_MASK_ARB, WGL_CONTEXT_CORE_PROFILE_BIT_ARB,
+		0
+	};
 
+	HGLRC context = wglCreateContextAttribsARB(hdc, NULL, attributes);
+	if (!context && log)
+		log->Error("Can't create OpenGL 3.3 core context");
+
+	return context;
 }
 
 bool IsGLExtensionSupported(const char *extension)
 {
+	if (glGetStringi)
+	{
+		GLint extensionsCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionsCount);
+
+		for (GLint i = 0; i < extensionsCount; i++)
+		{
+			if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), extension) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
 	const GLubyte *extensions = NULL;
 	const GLubyte *start;
 
@@ -90,12 +161,44 @@ void glCheckError(const char* filename /*= nullptr*/, unsigned int line /*= 0*/)
 	}
 }
 
-extern PFNGLGENFRAMEBUFFERSEXTPROC        glGenFramebuffersEXT = NULL;
-extern PFNGLBINDFRAMEBUFFEREXTPROC        glBindFramebufferEXT = NULL;
+extern PFNGLGENFRAMEBUFFERSPROC           glGenFramebuffers = NULL;
+extern PFNGLBINDFRAMEBUFFERPROC           glBindFramebuffer = NULL;
 extern PFNGLFRAMEBUFFERTEXTUREPROC        glFramebufferTexture = NULL;
 extern PFNGLDRAWBUFFERSPROC               glDrawBuffers = NULL;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers = NULL;
-extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT = NULL;
-extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
+extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffers = NULL;
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC    glCheckFramebufferStatus = NULL;
+
+extern PFNGLGETSTRINGIPROC                glGetStringi = NULL;
+extern PFNGLACTIVETEXTUREPROC             glActiveTexture = NULL;
+extern PFNGLGENBUFFERSPROC                glGenBuffers = NULL;
+extern PFNGLBINDBUFFERPROC                glBindBuffer = NULL;
+extern PFNGLBUFFERDATAPROC                glBufferData = NULL;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange = NULL;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer = NULL;
+extern PFNGLGENVERTEXARRAYSPROC           glGenVertexArrays = NULL;
+extern PFNGLBINDVERTEXARRAYPROC           glBindVertexArray = NULL;
+extern PFNGLDELETEVERTEXARRAYSPROC        glDeleteVertexArrays = NULL;
+extern PFNGLVERTEXATTRIBPOINTERPROC       glVertexAttribPointer = NULL;
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC   glEnableVertexAttribArray = NULL;
+extern PFNGLDRAWELEMENTSBASEVERTEXPROC    glDrawElementsBaseVertex = NULL;
+extern PFNGLVERTEXATTRIBDIVISORPROC       glVertexAttribDivisor = NULL;
+extern PFNGLDRAWARRAYSINSTANCEDPROC       glDrawArraysInstanced = NULL;
+extern PFNGLCREATESHADERPROC              glCreateShader = NULL;
+extern PFNGLSHADERSOURCEPROC              glShaderSource = NULL;
+extern PFNGLCOMPILESHADERPROC             glCompileShader = NULL;
+extern PFNGLGETSHADERIVPROC               glGetShaderiv = NULL;
+extern PFNGLGETSHADERINFOLOGPROC          glGetShaderInfoLog = NULL;
+extern PFNGLDELETESHADERPROC              glDeleteShader = NULL;
+extern PFNGLCREATEPROGRAMPROC             glCreateProgram = NULL;
+extern PFNGLATTACHSHADERPROC              glAttachShader = NULL;
+extern PFNGLLINKPROGRAMPROC               glLinkProgram = NULL;
+extern PFNGLGETPROGRAMIVPROC              glGetProgramiv = NULL;
+extern PFNGLGETPROGRAMINFOLOGPROC         glGetProgramInfoLog = NULL;
+extern PFNGLDELETEPROGRAMPROC             glDeleteProgram = NULL;
+extern PFNGLUSEPROGRAMPROC                glUseProgram = NULL;
+extern PFNGLGETUNIFORMLOCATIONPROC        glGetUniformLocation = NULL;
+extern PFNGLUNIFORMMATRIX4FVPROC          glUniformMatrix4fv = NULL;
+extern PFNGLUNIFORM1IPROC                 glUniform1i = NULL;
 
 #endif // PLATFORM_WINDOWS
@@ -8,6 +8,15 @@
 #include "3rdPartyLibs/OpenGL/glext.h"
 #include "3rdPartyLibs/OpenGL/wglext.h"
 
+#ifndef WGL_CONTEXT_MAJOR_VERSION_ARB
+#define WGL_CONTEXT_MAJOR_VERSION_ARB    0x2091
+#define WGL_CONTEXT_MINOR_VERSION_ARB    0x2092
+#define WGL_CONTEXT_FLAGS_ARB            0x2094
+#define WGL_CONTEXT_PROFILE_MASK_ARB     0x9126
+#define WGL_CONTEXT_CORE_PROFILE_BIT_ARB 0x00000001
+
+typedef HGLRC(WINAPI * PFNWGLCREATECONTEXTATTRIBSARBPROC) (HDC hDC, HGLRC hShareContext, const int *attribList);
+#endif
 
 namespace o2
 {
@@ -17,6 +26,9 @@ namespace o2
 // Getting openGL extensions
 void GetGLExtensions(o2::LogStream* log = nullptr);
 
+// Creates OpenGL 3.3 core profile context. Returns NULL when driver can't create it
+HGLRC CreateGLCoreContext(HDC hdc, o2::LogStream* log = nullptr);
+
 // Returns opengl error description by id
 const char* GetGLErrorDesc(GLenum errorId);
 
@@ -32,12 +44,44 @@ void glCheckError(const char* filename = nullptr, unsigned int line = 0);
 #	define GL_CHECK_ERROR()
 #endif
 
-extern PFNGLGENFRAMEBUFFERSEXTPROC        glGenFramebuffersEXT;
-extern PFNGLBINDFRAMEBUFFEREXTPROC        glBindFramebufferEXT;
+extern PFNGLGENFRAMEBUFFERSPROC           glGenFramebuffers;
+extern PFNGLBINDFRAMEBUFFERPROC           glBindFramebuffer;
 extern PFNGLFRAMEBUFFERTEXTUREPROC        glFramebufferTexture;
 extern PFNGLDRAWBUFFERSPROC               glDrawBuffers;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers;
-extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT;
-extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
+extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffers;
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC    glCheckFramebufferStatus;
+
+extern PFNGLGETSTRINGIPROC                glGetStringi;
+extern PFNGLACTIVETEXTUREPROC             glActiveTexture;
+extern PFNGLGENBUFFERSPROC                glGenBuffers;
+extern PFNGLBINDBUFFERPROC                glBindBuffer;
+extern PFNGLBUFFERDATAPROC                glBufferData;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer;
+extern PFNGLGENVERTEXARRAYSPROC           glGenVertexArrays;
+extern PFNGLBINDVERTEXARRAYPROC           glBindVertexArray;
+extern PFNGLDELETEVERTEXARRAYSPROC        glDeleteVertexArrays;
+extern PFNGLVERTEXATTRIBPOINTERPROC       glVertexAttribPointer;
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC   glEnableVertexAttribArray;
+extern PFNGLDRAWELEMENTSBASEVERTEXPROC    glDrawElementsBaseVertex;
+extern PFNGLVERTEXATTRIBDIVISORPROC       glVertexAttribDivisor;
+extern PFNGLDRAWARRAYSINSTANCEDPROC       glDrawArraysInstanced;
+extern PFNGLCREATESHADERPROC              glCreateShader;
+extern PFNGLSHADERSOURCEPROC              glShaderSource;
+extern PFNGLCOMPILESHADERPROC             glCompileShader;
+extern PFNGLGETSHADERIVPROC               glGetShaderiv;
+extern PFNGLGETSHADERINFOLOGPROC          glGetShaderInfoLog;
+extern PFNGLDELETESHADERPROC              glDeleteShader;
+extern PFNGLCREATEPROGRAMPROC             glCreateProgram;
+extern PFNGLATTACHSHADERPROC              glAttachShader;
+extern PFNGLLINKPROGRAMPROC               glLinkProgram;
+extern PFNGLGETPROGRAMIVPROC              glGetProgramiv;
+extern PFNGLGETPROGRAMINFOLOGPROC         glGetProgramInfoLog;
+extern PFNGLDELETEPROGRAMPROC             glDeleteProgram;
+extern PFNGLUSEPROGRAMPROC                glUseProgram;
+extern PFNGLGETUNIFORMLOCATIONPROC        glGetUniformLocation;
+extern PFNGLUNIFORMMATRIX4FVPROC          glUniformMatrix4fv;
+extern PFNGLUNIFORM1IPROC                 glUniform1i;
 
 #endif // PLATFORM_WINDOWS
@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined O2_HEADLESS
 
 #include "o2/Render/Windows/OpenGL.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -17,10 +17,58 @@ namespace o2
 		HGLRC mGLContext; // OpenGL context
 		HDC   mHDC;       // Windows frame device context
 
-		UInt8*  mVertexData;               // Vertex data buffer
-		UInt16* mVertexIndexData;          // Index data buffer
-		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
-		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+		GLuint mStdShader;              // Standard sprite shader program
+		GLint  mStdShaderMvpUniform;    // Standard shader matrix input parameter
+		GLint  mStdShaderTextureSample; // Standard shader texture sample input parameter
+
+		GLuint mVertexArrayObject;   // Vertex array object with batch buffers layout
+		GLuint mVertexBufferObject;  // Batch vertices ring buffer
+		GLuint mIndexBufferObject;   // Batch polygons indexes ring buffer
+		UInt   mVertexRingSize;      // Vertices ring buffer size in vertices
+		UInt   mIndexRingSize;       // Indexes ring buffer size in indexes
+		UInt   mVertexRingOffset;    // Current write position in vertices ring buffer
+		UInt   mIndexRingOffset;     // Current write position in indexes ring buffer
+		UInt   mRingBatchesCount = 4; // Count of maximum sized batches fitting into ring buffers before orphaning
+
+		GLuint mWhiteTexture; // 1x1 white texture, bound when drawing without texture
+
+		bool   mQuadInstancingAvailable = false; // True when quads can be expanded on GPU by instancing
+		GLuint mQuadShader;                      // Instanced quads shader program
+		GLint  mQuadShaderMvpUniform;            // Instanced quads shader matrix input parameter
+		GLuint mQuadVertexArrayObject;           // Vertex array object with instanced quads layout
+		GLuint mQuadCornersBufferObject;         // Unit quad corners buffer
+		GLuint mQuadInstancesBufferObject;       // Quads instances ring buffer
+		UInt   mQuadInstancesRingSize;           // Quads instances ring buffer size in instances
+		UInt   mQuadInstancesRingOffset;         // Current write position in quads instances ring buffer
+
+		UInt8* mQuadInstancesData;                    // Quads instances batch buffer
+		UInt   mQuadInstancesBufferSize = 1 << 16;    // Maximum quads instances in batch
+		UInt   mLastDrawQuadInstance = 0;             // Quads instances count in current batch
+		UInt   mMinInstancedQuadsCount = 64;          // Minimum quads count, drawn by instancing. Shorter runs are expanded into vertices batch, so mixing them with other draws doesn't break batches
+
+		UInt8*       mVertexData;               // Vertex data buffer
+		VertexIndex* mVertexIndexData;          // Index data buffer
+		UInt         mVertexBufferSize = 6000;  // Maximum size of vertex buffer
+		UInt         mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+	protected:
+		// Builds vertex or fragment shader
+		GLuint LoadShader(GLenum shaderType, const char* source);
+
+		// Builds shader program from vertex and fragment shaders
+		GLuint BuildShaderProgram(const char* vertexSource, const char* fragmentSource);
+
+		// Initializes standard shader
+		void InitializeStdShader();
+
+		// Initializes vertex array object and batch ring buffers
+		void InitializeBatchBuffers();
+
+		// Initializes instanced quads shader and buffers. Quads are expanded on CPU when it isn't available
+		void InitializeQuadInstancing();
+
+		// Sets instanced quads attributes pointers starting from specified offset in instances buffer
+		void SetupQuadInstancesAttributes(UInt offset);
 	};
 };
 
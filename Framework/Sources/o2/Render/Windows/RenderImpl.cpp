@@ -1,6 +1,6 @@
 #include "o2/stdafx.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined O2_HEADLESS
 #include "o2/Render/Render.h"
 
 #include "o2/Application/Application.h"
@@ -9,6 +9,7 @@
 #include "o2/Events/EventSystem.h"
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
+#include "o2/Render/QuadInstance.h"
 #include "o2/Render/Sprite.h"
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
@@ -21,8 +22,8 @@ namespace o2
 	Render::Render() :
 		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
 	{
-		mVertexBufferSize = USHRT_MAX;
-		mIndexBufferSize = USHRT_MAX;
+		mVertexBufferSize = mDefaultBatchVerticesCapacity;
+		mIndexBufferSize = mDefaultBatchIndexesCapacity;
 
 		// Create log stream
 		mLog = mnew LogStream("Render");
@@ -89,6 +90,32 @@ namespace o2
 			return;
 		}
 
+		// Replace legacy context with core profile context. Render uses vertex arrays objects and GLSL 330 shaders, 
+		// so it can't work without it
+		HGLRC coreContext = CreateGLCoreContext(mHDC, mLog);
+		if (!coreContext)
+		{
+			mLog->Error("Can't Create A GL 3.3 Core Rendering Context, OpenGL 3.3 is required.\n");
+
+			wglMakeCurrent(NULL, NULL);
+			wglDeleteContext(mGLContext);
+			mGLContext = NULL;
+			return;
+		}
+
+		wglMakeCurrent(NULL, NULL);
+		wglDeleteContext(mGLContext);
+		mGLContext = coreContext;
+
+		if (!wglMakeCurrent(mHDC, mGLContext))
+		{
+			mLog->Error("Can't Activate The GL Core Rendering Context.\n");
+
+			wglDeleteContext(mGLContext);
+			mGLContext = NULL;
+			return;
+		}
+
 		// Get OpenGL extensions
 		GetGLExtensions(mLog);
 
@@ -100,19 +127,15 @@ namespace o2
 		// Initialize buffers
 		mVertexData = mnew UInt8[mVertexBufferSize * sizeof(Vertex2)];
 
-		mVertexIndexData = mnew UInt16[mIndexBufferSize];
+		mVertexIndexData = mnew VertexIndex[mIndexBufferSize];
 		mLastDrawVertex = 0;
 		mTrianglesCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		// Configure OpenGL
-		glEnableClientState(GL_COLOR_ARRAY);
-		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-		glEnableClientState(GL_VERTEX_ARRAY);
-
-		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), mVertexData + sizeof(float) * 3);
-		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), mVertexData + sizeof(float) * 3 + sizeof(unsigned long));
-		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
+		InitializeBatchBuffers();
+		InitializeStdShader();
+		InitializeQuadInstancing();
 
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -132,6 +155,7 @@ namespace o2
 
 		InitializeFreeType();
 		InitializeLinesIndexBuffer();
+		InitializeQuadsIndexBuffer();
 		InitializeLinesTextures();
 
 		mCurrentRenderTarget = TextureRef();
@@ -163,6 +187,21 @@ namespace o2
 			for (auto texture : textures)
 				delete texture;
 
+			glDeleteTextures(1, &mWhiteTexture);
+			glDeleteProgram(mStdShader);
+			glDeleteBuffers(1, &mVertexBufferObject);
+			glDeleteBuffers(1, &mIndexBufferObject);
+			glDeleteVertexArrays(1, &mVertexArrayObject);
+
+			if (mQuadInstancingAvailable)
+			{
+				glDeleteProgram(mQuadShader);
+				glDeleteBuffers(1, &mQuadCornersBufferObject);
+				glDeleteBuffers(1, &mQuadInstancesBufferObject);
+				glDeleteVertexArrays(1, &mQuadVertexArrayObject);
+				delete[] mQuadInstancesData;
+			}
+
 			if (!wglMakeCurrent(NULL, NULL))
 				mLog->Error("Release ff DC And RC Failed.\n");
 
@@ -177,17 +216,299 @@ namespace o2
 		mReady = false;
 	}
 
+	GLuint RenderBase::LoadShader(GLenum shaderType, const char* source)
+	{
+		GLuint shader = glCreateShader(shaderType);
+
+		if (shader)
+		{
+			glShaderSource(shader, 1, &source, NULL);
+			glCompileShader(shader);
+
+			GLint compiled = 0;
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+
+			if (!compiled)
+			{
+				GLint infoLen = 0;
+				glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLen);
+
+				if (infoLen > 0)
+				{
+					char* infoLog = mnew char[infoLen];
+					glGetShaderInfoLog(shader, infoLen, NULL, infoLog);
+					o2Debug.LogError((String)"Error compiling shader:\n" + infoLog);
+					delete[] infoLog;
+				}
+
+				glDeleteShader(shader);
+				shader = 0;
+			}
+		}
+
+		return shader;
+	}
+
+	GLuint RenderBase::BuildShaderProgram(const char* vertexSource, const char* fragmentSource)
+	{
+		GLuint vertexShader = LoadShader(GL_VERTEX_SHADER, vertexSource);
+		if (!vertexShader)
+			return 0;
+
+		GLuint fragmentShader = LoadShader(GL_FRAGMENT_SHADER, fragmentSource);
+		if (!fragmentShader)
+		{
+			glDeleteShader(vertexShader);
+			return 0;
+		}
+
+		GLuint program = glCreateProgram();
+		if (program)
+		{
+			glAttachShader(program, vertexShader);
+			glAttachShader(program, fragmentShader);
+
+			GLint linkStatus;
+			glLinkProgram(program);
+			glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+
+			if (!linkStatus)
+			{
+				GLint infoLen = 0;
+				glGetProgramiv(program, GL_INFO_LOG_LENGTH, &infoLen);
+
+				if (infoLen > 0)
+				{
+					char* infoLog = mnew char[infoLen];
+					glGetProgramInfoLog(program, infoLen, NULL, infoLog);
+					o2Debug.LogError((String)"Error linking shader:\n" + infoLog);
+					delete[] infoLog;
+				}
+
+				glDeleteProgram(program);
+				program = 0;
+			}
+		}
+
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+
+		return program;
+	}
+
+	// Fragment shader for standard and instanced quads shaders
+	static const char* stdFragmentShader =
+		"#version 330 core                                 \n"
+		"uniform sampler2D u_texture;                      \n"
+		"                                                  \n"
+		"in vec4 v_color;                                  \n"
+		"in vec2 v_texCoords;                              \n"
+		"                                                  \n"
+		"out vec4 o_color;                                 \n"
+		"                                                  \n"
+		"void main()                                       \n"
+		"{                                                 \n"
+		"    o_color = v_color*texture(u_texture, v_texCoords); \n"
+		"}                                                 \n";
+
+	void RenderBase::InitializeStdShader()
+	{
+		const char* vtxShader =
+			"#version 330 core                                 \n"
+			"uniform mat4 u_transformMatrix;                   \n"
+			"                                                  \n"
+			"layout(location = 0) in vec3 a_position;          \n"
+			"layout(location = 1) in vec4 a_color;             \n"
+			"layout(location = 2) in vec2 a_texCoords;         \n"
+			"                                                  \n"
+			"out vec4 v_color;                                 \n"
+			"out vec2 v_texCoords;                             \n"
+			"                                                  \n"
+			"void main()                                       \n"
+			"{                                                 \n"
+			"    v_color = a_color;                            \n"
+			"    v_texCoords = a_texCoords;                    \n"
+			"    gl_Position = u_transformMatrix*vec4(a_position, 1.0);   \n"
+			"}                                                 \n";
+
+		mStdShader = BuildShaderProgram(vtxShader, stdFragmentShader);
+		GL_CHECK_ERROR();
+
+		mStdShaderMvpUniform = glGetUniformLocation(mStdShader, "u_transformMatrix");
+		mStdShaderTextureSample = glGetUniformLocation(mStdShader, "u_texture");
+		GL_CHECK_ERROR();
+
+		glUseProgram(mStdShader);
+		glUniform1i(mStdShaderTextureSample, 0);
+		GL_CHECK_ERROR();
+
+		// White texture is used for drawing without texture, so shader doesn't need to branch
+		ULong whitePixel = 0xffffffff;
+		glGenTextures(1, &mWhiteTexture);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, mWhiteTexture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &whitePixel);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		GL_CHECK_ERROR();
+	}
+
+	void RenderBase::InitializeQuadInstancing()
+	{
+		mQuadInstancingAvailable = false;
+
+		if (!glVertexAttribDivisor || !glDrawArraysInstanced)
+			return;
+
+		// Quad corners are expanded by unit corner: origin + xv*corner.x + yv*corner.y
+		const char* vtxShader =
+			"#version 330 core                                 \n"
+			"uniform mat4 u_transformMatrix;                   \n"
+			"                                                  \n"
+			"layout(location = 0) in vec2 a_corner;            \n"
+			"layout(location = 1) in vec4 a_originXv;          \n"
+			"layout(location = 2) in vec2 a_yv;                \n"
+			"layout(location = 3) in vec4 a_uvRect;            \n"
+			"layout(location = 4) in vec4 a_color;             \n"
+			"                                                  \n"
+			"out vec4 v_color;                                 \n"
+			"out vec2 v_texCoords;                             \n"
+			"                                                  \n"
+			"void main()                                       \n"
+			"{                                                 \n"
+			"    vec2 position = a_originXv.xy + a_originXv.zw*a_corner.x + a_yv*a_corner.y; \n"
+			"    v_color = a_color;                            \n"
+			"    v_texCoords = vec2(mix(a_uvRect.x, a_uvRect.z, a_corner.x),  \n"
+			"                       mix(a_uvRect.w, a_uvRect.y, a_corner.y)); \n"
+			"    gl_Position = u_transformMatrix*vec4(position, 1.0, 1.0);    \n"
+			"}                                                 \n";
+
+		mQuadShader = BuildShaderProgram(vtxShader, stdFragmentShader);
+		if (!mQuadShader)
+		{
+			o2Debug.LogWarning("Instanced quads shader isn't available, quads will be expanded on CPU");
+			return;
+		}
+
+		mQuadShaderMvpUniform = glGetUniformLocation(mQuadShader, "u_transformMatrix");
+
+		glUseProgram(mQuadShader);
+		glUniform1i(glGetUniformLocation(mQuadShader, "u_texture"), 0);
+
+		float corners[] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+
+		glGenVertexArrays(1, &mQuadVertexArrayObject);
+		glBindVertexArray(mQuadVertexArrayObject);
+
+		glGenBuffers(1, &mQuadCornersBufferObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mQuadCornersBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float)*2, (void*)0);
+		glEnableVertexAttribArray(0);
+
+		mQuadInstancesRingSize = mQuadInstancesBufferSize*mRingBatchesCount;
+		mQuadInstancesRingOffset = 0;
+
+		glGenBuffers(1, &mQuadInstancesBufferObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mQuadInstancesBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mQuadInstancesRingSize*sizeof(QuadInstance), NULL, GL_STREAM_DRAW);
+
+		for (GLuint location = 1; location <= 4; location++)
+		{
+			glEnableVertexAttribArray(location);
+			glVertexAttribDivisor(location, 1);
+		}
+
+		SetupQuadInstancesAttributes(0);
+
+		mQuadInstancesData = mnew UInt8[mQuadInstancesBufferSize*sizeof(QuadInstance)];
+		mQuadInstancingAvailable = true;
+
+		// Restore standard batch state
+		glBindVertexArray(mVertexArrayObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glUseProgram(mStdShader);
+
+		GL_CHECK_ERROR();
+	}
+
+	void RenderBase::SetupQuadInstancesAttributes(UInt offset)
+	{
+		const GLsizei stride = sizeof(QuadInstance);
+		const size_t base = offset*sizeof(QuadInstance);
+
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(QuadInstance, origin)));
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(QuadInstance, yv)));
+		glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(QuadInstance, uvLeft)));
+		glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)(base + offsetof(QuadInstance, color)));
+	}
+
+	void RenderBase::InitializeBatchBuffers()
+	{
+		mVertexRingSize = mVertexBufferSize*mRingBatchesCount;
+		mIndexRingSize = mIndexBufferSize*mRingBatchesCount;
+		mVertexRingOffset = 0;
+		mIndexRingOffset = 0;
+
+		glGenVertexArrays(1, &mVertexArrayObject);
+		glBindVertexArray(mVertexArrayObject);
+
+		glGenBuffers(1, &mVertexBufferObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mVertexRingSize*sizeof(Vertex2), NULL, GL_STREAM_DRAW);
+
+		glGenBuffers(1, &mIndexBufferObject);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexRingSize*sizeof(VertexIndex), NULL, GL_STREAM_DRAW);
+
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex2), (void*)offsetof(Vertex2, x));
+		glEnableVertexAttribArray(0);
+
+		glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex2), (void*)offsetof(Vertex2, color));
+		glEnableVertexAttribArray(1);
+
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2), (void*)offsetof(Vertex2, tu));
+		glEnableVertexAttribArray(2);
+
+		GL_CHECK_ERROR();
+	}
+
+	void Render::OnBatchCapacityChanged()
+	{
+		mVertexRingSize = mVertexBufferSize*mRingBatchesCount;
+		mIndexRingSize = mIndexBufferSize*mRingBatchesCount;
+		mVertexRingOffset = 0;
+		mIndexRingOffset = 0;
+
+		glBindVertexArray(mVertexArrayObject);
+
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mVertexRingSize*sizeof(Vertex2), NULL, GL_STREAM_DRAW);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexRingSize*sizeof(VertexIndex), NULL, GL_STREAM_DRAW);
+
+		GL_CHECK_ERROR();
+	}
+
 	void Render::CheckCompatibles()
 	{
-		//check render targets available
-		char* extensions[] = { "GL_ARB_framebuffer_object", "GL_EXT_framebuffer_object", "GL_EXT_framebuffer_blit",
-			"GL_EXT_packed_depth_stencil" };
+		//check render targets available: frame buffers are part of core since OpenGL 3.0
+		GLint majorVersion = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
 
 		mRenderTargetsAvailable = true;
-		for (int i = 0; i < 4; i++)
+		if (majorVersion < 3)
 		{
-			if (!IsGLExtensionSupported(extensions[i]))
-				mRenderTargetsAvailable = false;
+			char* extensions[] = { "GL_ARB_framebuffer_object", "GL_EXT_framebuffer_object", "GL_EXT_framebuffer_blit",
+				"GL_EXT_packed_depth_stencil" };
+
+			for (int i = 0; i < 4; i++)
+			{
+				if (!IsGLExtensionSupported(extensions[i]))
+					mRenderTargetsAvailable = false;
+			}
 		}
 
 		//get max texture size
@@ -203,9 +524,13 @@ namespace o2
 		mLastDrawTexture = NULL;
 		mLastDrawVertex = 0;
 		mLastDrawIdx = 0;
+		mLastDrawQuadInstance = 0;
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mTextureSwitchesCount = 0;
+		mScissorChangesCount = 0;
+		mSortingSavedDIPsCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -224,12 +549,76 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		SubmitSortedDraws();
+
+		if (mLastDrawQuadInstance > 0)
+		{
+			if (mQuadInstancesRingOffset + mLastDrawQuadInstance > mQuadInstancesRingSize)
+			{
+				glBindBuffer(GL_ARRAY_BUFFER, mQuadInstancesBufferObject);
+				glBufferData(GL_ARRAY_BUFFER, mQuadInstancesRingSize*sizeof(QuadInstance), NULL, GL_STREAM_DRAW);
+				mQuadInstancesRingOffset = 0;
+			}
+
+			glBindVertexArray(mQuadVertexArrayObject);
+			glBindBuffer(GL_ARRAY_BUFFER, mQuadInstancesBufferObject);
+			glUseProgram(mQuadShader);
+
+			const GLbitfield instancesMapFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+			void* instancesDst = glMapBufferRange(GL_ARRAY_BUFFER, mQuadInstancesRingOffset*sizeof(QuadInstance),
+												  mLastDrawQuadInstance*sizeof(QuadInstance), instancesMapFlags);
+			memcpy(instancesDst, mQuadInstancesData, mLastDrawQuadInstance*sizeof(QuadInstance));
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+
+			SetupQuadInstancesAttributes(mQuadInstancesRingOffset);
+			glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, 4, mLastDrawQuadInstance);
+
+			glUseProgram(mStdShader);
+			glBindVertexArray(mVertexArrayObject);
+			glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+
+			GL_CHECK_ERROR();
+
+			mQuadInstancesRingOffset += mLastDrawQuadInstance;
+			mFrameTrianglesCount += mLastDrawQuadInstance*2;
+			mLastDrawQuadInstance = 0;
+
+			mDIPCount++;
+		}
+
 		if (mLastDrawVertex < 1)
 			return;
 
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
-		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
+		// Orphan ring buffers when batch doesn't fit into the rest, driver gives new storage without sync
+		if (mVertexRingOffset + mLastDrawVertex > mVertexRingSize || mIndexRingOffset + mLastDrawIdx > mIndexRingSize)
+		{
+			glBufferData(GL_ARRAY_BUFFER, mVertexRingSize*sizeof(Vertex2), NULL, GL_STREAM_DRAW);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexRingSize*sizeof(VertexIndex), NULL, GL_STREAM_DRAW);
+
+			mVertexRingOffset = 0;
+			mIndexRingOffset = 0;
+		}
+
+		const GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+		void* vertexDst = glMapBufferRange(GL_ARRAY_BUFFER, mVertexRingOffset*sizeof(Vertex2),
+										   mLastDrawVertex*sizeof(Vertex2), mapFlags);
+		memcpy(vertexDst, mVertexData, mLastDrawVertex*sizeof(Vertex2));
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+
+		void* indexDst = glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, mIndexRingOffset*sizeof(VertexIndex),
+										  mLastDrawIdx*sizeof(VertexIndex), mapFlags);
+		memcpy(indexDst, mVertexIndexData, mLastDrawIdx*sizeof(VertexIndex));
+		glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+		const GLenum indexType = RENDER_32BIT_INDEXES ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+		glDrawElementsBaseVertex(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, indexType,
+								 (void*)(mIndexRingOffset*sizeof(VertexIndex)), mVertexRingOffset);
+
+		mVertexRingOffset += mLastDrawVertex;
+		mIndexRingOffset += mLastDrawIdx;
 
 		GL_CHECK_ERROR();
 
@@ -244,12 +633,7 @@ namespace o2
 		mCurrentResolution = viewSize;
 		mCamera = Camera();
 
-		float projMat[16];
-		Math::OrthoProjMatrix(projMat, 0.0f, (float)viewSize.x, (float)viewSize.y, 0.0f, 0.0f, 10.0f);
-		glMatrixMode(GL_PROJECTION);
-		glLoadIdentity();
 		glViewport(0, 0, viewSize.x, viewSize.y);
-		glLoadMatrixf(projMat);
 
 		UpdateCameraTransforms();
 	}
@@ -279,13 +663,28 @@ namespace o2
 		GL_CHECK_ERROR();
 	}
 
+	// Multiplies column-major 4x4 matrices
+	static void MultiplyMatrix(float* ret, const float* lhs, const float* rhs)
+	{
+		for (int col = 0; col < 4; col++)
+		{
+			for (int row = 0; row < 4; row++)
+			{
+				ret[col*4 + row] = lhs[row]*rhs[col*4] + lhs[4 + row]*rhs[col*4 + 1] +
+					lhs[8 + row]*rhs[col*4 + 2] + lhs[12 + row]*rhs[col*4 + 3];
+			}
+		}
+	}
+
 	void Render::UpdateCameraTransforms()
 	{
 		DrawPrimitives();
 
 		Vec2F resf = (Vec2F)mCurrentResolution;
 
-		glMatrixMode(GL_MODELVIEW);
+		float projMat[16];
+		Math::OrthoProjMatrix(projMat, 0.0f, resf.x, resf.y, 0.0f, 0.0f, 10.0f);
+
 		float modelMatrix[16] =
 		{
 			1,           0,            0, 0,
@@ -294,8 +693,6 @@ namespace o2
 			Math::Round(resf.x*0.5f), Math::Round(resf.y*0.5f), -1, 1
 		};
 
-		glLoadMatrixf(modelMatrix);
-
 		Basis defaultCameraBasis((Vec2F)mCurrentResolution*-0.5f, Vec2F::Right()*resf.x, Vec2F().Up()*resf.y);
 		Basis camTransf = mCamera.GetBasis().Inverted()*defaultCameraBasis;
 		mViewScale = Vec2F(camTransf.xv.Length(), camTransf.yv.Length());
@@ -309,7 +706,21 @@ namespace o2
 			camTransf.origin.x, camTransf.origin.y, 0, 1
 		};
 
-		glMultMatrixf(camTransfMatr);
+		float modelViewMatr[16];
+		float mvpMatr[16];
+		MultiplyMatrix(modelViewMatr, modelMatrix, camTransfMatr);
+		MultiplyMatrix(mvpMatr, projMat, modelViewMatr);
+
+		glUniformMatrix4fv(mStdShaderMvpUniform, 1, GL_FALSE, mvpMatr);
+
+		if (mQuadInstancingAvailable)
+		{
+			glUseProgram(mQuadShader);
+			glUniformMatrix4fv(mQuadShaderMvpUniform, 1, GL_FALSE, mvpMatr);
+			glUseProgram(mStdShader);
+		}
+
+		GL_CHECK_ERROR();
 	}
 
 	void Render::BeginRenderToStencilBuffer()
@@ -410,6 +821,7 @@ namespace o2
 
 		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
 		mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
+		mScissorChangesCount++;
 		
 		RectI screenScissorRect = CalculateScreenSpaceScissorRect(summaryScissorRect);
 		glScissor((int)(screenScissorRect.left + mCurrentResolution.x*0.5f), (int)(screenScissorRect.bottom + mCurrentResolution.y*0.5f),
@@ -426,6 +838,8 @@ namespace o2
 
 		DrawPrimitives();
 
+		mScissorChangesCount++;
+
 		if (forcible)
 		{
 			glDisable(GL_SCISSOR_TEST);
@@ -474,29 +888,44 @@ namespace o2
 	}
 
 	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+							VertexIndex* indexes, UInt elementsCount, const TextureRef& texture)
 	{
 		if (!mReady)
 			return;
 
-		mDrawingDepth += 1.0f;
+		// Deferred draws have got depth when was added
+		if (!mSubmittingSortedDraws)
+			mDrawingDepth += 1.0f;
 
 		if (mClippingEverything)
 			return;
 
+		if (mDrawsSortingDepth > 0 && !mSubmittingSortedDraws)
+		{
+			AddSortingDrawCall(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+			return;
+		}
+
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount * 2;
 		else
 			indexesCount = elementsCount * 3;
 
+		if (!CheckBatchCapacity(verticesCount, indexesCount))
+			return;
+
 		if (mLastDrawTexture != texture.mTexture ||
+			mLastDrawQuadInstance > 0 ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType != primitiveType)
 		{
 			DrawPrimitives();
 
+			if (mLastDrawTexture != texture.mTexture)
+				mTextureSwitchesCount++;
+
 			mLastDrawTexture = texture.mTexture;
 			mCurrentPrimitiveType = primitiveType;
 
@@ -505,14 +934,8 @@ namespace o2
 			else
 				glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
-			if (mLastDrawTexture)
-			{
-				glEnable(GL_TEXTURE_2D);
-				glBindTexture(GL_TEXTURE_2D, mLastDrawTexture->mHandle);
-
-				GL_CHECK_ERROR();
-			}
-			else glDisable(GL_TEXTURE_2D);
+			glBindTexture(GL_TEXTURE_2D, mLastDrawTexture ? mLastDrawTexture->mHandle : mWhiteTexture);
+			GL_CHECK_ERROR();
 		}
 
 		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
@@ -527,6 +950,59 @@ namespace o2
 		mLastDrawIdx += indexesCount;
 	}
 
+	void Render::DrawQuadInstances(const QuadInstance* instances, UInt count, const TextureRef& texture)
+	{
+		if (!mReady || count == 0)
+			return;
+
+		// Deferred draws sorting works with vertices. Also vertices batch with same texture is continued, and short runs
+		// are expanded on CPU, because switching between instances and vertices batches flushes them
+		bool continueVerticesBatch = mLastDrawVertex > 0 && mLastDrawTexture == texture.mTexture &&
+			mCurrentPrimitiveType == PrimitiveType::Polygon;
+
+		if (!mQuadInstancingAvailable || mDrawsSortingDepth > 0 || mSubmittingSortedDraws || continueVerticesBatch ||
+			(count < mMinInstancedQuadsCount && mLastDrawQuadInstance == 0))
+		{
+			DrawQuadInstancesExpanded(instances, count, texture);
+			return;
+		}
+
+		mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		// Previous batch can be already flushed, but with wire polygon mode or lines state
+		if (mLastDrawTexture != texture.mTexture || mLastDrawVertex > 0 || mCurrentPrimitiveType != PrimitiveType::Polygon)
+		{
+			DrawPrimitives();
+
+			if (mLastDrawTexture != texture.mTexture)
+				mTextureSwitchesCount++;
+
+			mLastDrawTexture = texture.mTexture;
+			mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+			glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+			glBindTexture(GL_TEXTURE_2D, mLastDrawTexture ? mLastDrawTexture->mHandle : mWhiteTexture);
+			GL_CHECK_ERROR();
+		}
+
+		for (UInt offset = 0; offset < count;)
+		{
+			UInt chunkCount = Math::Min(count - offset, mQuadInstancesBufferSize - mLastDrawQuadInstance);
+
+			memcpy(&mQuadInstancesData[mLastDrawQuadInstance*sizeof(QuadInstance)], instances + offset,
+				   chunkCount*sizeof(QuadInstance));
+
+			mLastDrawQuadInstance += chunkCount;
+			offset += chunkCount;
+
+			if (mLastDrawQuadInstance == mQuadInstancesBufferSize)
+				DrawPrimitives();
+		}
+	}
+
 	void Render::BindRenderTexture(TextureRef renderTarget)
 	{
 		if (!renderTarget)
@@ -560,7 +1036,7 @@ namespace o2
 
 		mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
 
-		glBindFramebufferEXT(GL_FRAMEBUFFER, renderTarget->mFrameBuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, renderTarget->mFrameBuffer);
 		GL_CHECK_ERROR();
 
 		SetupViewMatrix(renderTarget->GetSize());
@@ -575,7 +1051,7 @@ namespace o2
 
 		DrawPrimitives();
 
-		glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 		GL_CHECK_ERROR();
 
 		SetupViewMatrix(mResolution);
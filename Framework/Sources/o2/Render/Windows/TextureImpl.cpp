@@ -1,6 +1,6 @@
 #include "o2/stdafx.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined O2_HEADLESS
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 
@@ -8,13 +8,13 @@ namespace o2
 {
 	Texture::~Texture()
 	{
-		o2Render.mTextures.Remove(this);
+		o2Render.RemoveTexture(this);
 
 		if (!mReady)
 			return;
 
 		if (mUsage == Usage::RenderTarget)
-			glDeleteFramebuffersEXT(1, &mFrameBuffer);
+			glDeleteFramebuffers(1, &mFrameBuffer);
 
 		glDeleteTextures(1, &mHandle);
 	}
@@ -24,7 +24,7 @@ namespace o2
 		if (mReady)
 		{
 			if (mUsage == Usage::RenderTarget)
-				glDeleteFramebuffersEXT(1, &mFrameBuffer);
+				glDeleteFramebuffers(1, &mFrameBuffer);
 
 			glDeleteTextures(1, &mHandle);
 		}
@@ -33,7 +33,7 @@ namespace o2
 		mUsage = usage;
 		mSize = size;
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 
 		glGenTextures(1, &mHandle);
 		glBindTexture(GL_TEXTURE_2D, mHandle);
@@ -53,15 +53,15 @@ namespace o2
 
 		if (mUsage == Usage::RenderTarget)
 		{
-			glGenFramebuffersEXT(1, &mFrameBuffer);
-			glBindFramebufferEXT(GL_FRAMEBUFFER, mFrameBuffer);
+			glGenFramebuffers(1, &mFrameBuffer);
+			glBindFramebuffer(GL_FRAMEBUFFER, mFrameBuffer);
 
 			glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mHandle, 0);
 
 			GLenum DrawBuffers[2] = { GL_COLOR_ATTACHMENT0 };
 			glDrawBuffers(1, DrawBuffers);
 
-			if (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 			{
 				GLenum glError = glGetError();
 
@@ -76,7 +76,7 @@ namespace o2
 
 			mReady = true;
 
-			glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
@@ -89,7 +89,7 @@ namespace o2
 		if (mReady)
 		{
 			if (mUsage == Usage::RenderTarget)
-				glDeleteFramebuffersEXT(1, &mFrameBuffer);
+				glDeleteFramebuffers(1, &mFrameBuffer);
 
 			glDeleteTextures(1, &mHandle);
 		}
@@ -97,9 +97,9 @@ namespace o2
 		mFormat = bitmap->GetFormat();
 		mUsage = Usage::Default;
 		mSize = bitmap->GetSize();
-		mFileName = bitmap->GetFilename();
+		SetSource(bitmap->GetFilename(), mAtlasAssetId, mAtlasPage);
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 
 		glGenTextures(1, &mHandle);
 		glBindTexture(GL_TEXTURE_2D, mHandle);
@@ -125,7 +125,7 @@ namespace o2
 
 	void Texture::SetData(Bitmap* bitmap)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
 		GLint texFormat = GL_RGB;
@@ -146,7 +146,7 @@ namespace o2
 
 	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
 		GLint texFormat = GL_RGB;
@@ -165,7 +165,7 @@ namespace o2
 
 	void Texture::Copy(const Texture& from, const RectI& rect)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 		glBindTexture(GL_TEXTURE_2D, from.mHandle);
 
 		GLint texFormat = GL_RGB;
@@ -182,7 +182,7 @@ namespace o2
 	{
 		Bitmap* bitmap = mnew Bitmap(mFormat, mSize);
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 		glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, bitmap->GetData());
 		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
@@ -198,7 +198,7 @@ namespace o2
 		if (mFilter == Filter::Nearest)
 			type = GL_NEAREST;
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : o2Render.mWhiteTexture;
 		o2Render.DrawPrimitives();
 
 		glBindTexture(GL_TEXTURE_2D, mHandle);
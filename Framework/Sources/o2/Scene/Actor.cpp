@@ -291,8 +291,8 @@ namespace o2
 
 		OnUpdate(dt);
 
-		for (auto comp : mComponents)
-			comp->Update(dt);
+		if (mSceneStatus != SceneStatus::InScene)
+			UpdateComponents(dt);
 	}
 
 	void Actor::FixedUpdate(float dt)
@@ -303,19 +303,25 @@ namespace o2
 	void Actor::UpdateChildren(float dt)
 	{
 		for (auto child : mChildren)
+		{
 			child->Update(dt);
-
-		for (auto child : mChildren)
 			child->UpdateChildren(dt);
+		}
 	}
 
 	void Actor::FixedUpdateChildren(float dt)
 	{
 		for (auto child : mChildren)
+		{
 			child->FixedUpdate(dt);
-
-		for (auto child : mChildren)
 			child->FixedUpdateChildren(dt);
+		}
+	}
+
+	void Actor::UpdateComponents(float dt)
+	{
+		for (auto comp : mComponents)
+			comp->Update(dt);
 	}
 
 	void Actor::UpdateTransform()
@@ -542,6 +548,9 @@ namespace o2
 		else if (IsOnScene() && Scene::IsSingletonInitialzed())
 			o2Scene.mRootActors.Add(this);
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorParentChanged(this);
+
 		if (worldPositionStays)
 			transform->SetWorldBasis(lastParentBasis);
 		else
@@ -660,6 +669,9 @@ namespace o2
 		actor->mParent = nullptr;
 		mChildren.Remove(actor);
 
+		if (actor->IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorParentChanged(actor);
+
 		actor->OnParentChanged(oldParent);
 		OnChildRemoved(actor);
 		OnChildrenChanged();
@@ -678,6 +690,10 @@ namespace o2
 		for (auto child : mChildren)
 		{
 			child->mParent = nullptr;
+
+			if (child->IsOnScene() && Scene::IsSingletonInitialzed())
+				o2Scene.OnActorParentChanged(child);
+
 			OnChildRemoved(child);
 			child->OnParentChanged(this);
 
@@ -864,7 +880,10 @@ namespace o2
 		}
 
 		for (auto comp : mComponents)
+		{
 			comp->OnAddToScene();
+			comp->RegisterUpdating();
+		}
 	}
 
 	void Actor::OnRemoveFromScene()
@@ -878,7 +897,10 @@ namespace o2
 		}
 
 		for (auto comp : mComponents)
+		{
+			comp->UnregisterUpdating();
 			comp->OnRemoveFromScene();
+		}
 	}
 
 	void Actor::OnStart()
@@ -917,7 +939,10 @@ namespace o2
 	void Actor::OnComponentAdded(Component* component)
 	{
 		if (mSceneStatus == SceneStatus::InScene)
+		{
 			component->OnAddToScene();
+			component->RegisterUpdating();
+		}
 
 		for (auto comp : mComponents)
 			comp->OnComponentAdded(component);
@@ -925,6 +950,8 @@ namespace o2
 
 	void Actor::OnComponentRemoving(Component* component)
 	{
+		component->UnregisterUpdating();
+
 		if (IsOnScene())
 			component->OnRemoveFromScene();
 
@@ -83,7 +83,7 @@ namespace o2
 		// Assign operator
 		Actor& operator=(const Actor& other);
 
-		// Updates actor and components
+		// Updates actor. Components are updated here only when actor isn't on scene, otherwise scene updates them
 		virtual void Update(float dt);
 
 		// Updates actor and components with fixed delta time
@@ -95,6 +95,10 @@ namespace o2
 		// Updates childs with fixed delta time
 		virtual void FixedUpdateChildren(float dt);
 
+		// Updates components. Components of actors on scene are updated by scene update lists, it is used
+		// for actors, updated outside of scene
+		void UpdateComponents(float dt);
+
 		// Updates self transform, dependent parents and children transforms
 		virtual void UpdateTransform();
 
@@ -781,6 +785,7 @@ CLASS_METHODS_META(o2::Actor)
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
 	PUBLIC_FUNCTION(void, UpdateChildren, float);
 	PUBLIC_FUNCTION(void, FixedUpdateChildren, float);
+	PUBLIC_FUNCTION(void, UpdateComponents, float);
 	PUBLIC_FUNCTION(void, UpdateTransform);
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_FUNCTION(void, UpdateChildrenTransforms);
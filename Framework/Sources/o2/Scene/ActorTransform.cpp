@@ -3,6 +3,7 @@
 
 #include "o2/Application/Input.h"
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 
 namespace o2
 {
@@ -683,6 +684,9 @@ namespace o2
 		mData->dirtyFrame = o2Time.GetCurrentFrame();
 		mData->updateFrame = 0;
 
+		if (mData->hierarchyIndex >= 0)
+			o2Scene.GetTransformsHierarchy()->SetDirty(mData->hierarchyIndex);
+
 		if (mData->owner && !fromParent)
 		{
 			mData->owner->OnChanged();
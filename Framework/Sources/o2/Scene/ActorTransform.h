@@ -461,6 +461,7 @@ namespace o2
 		Vec2F GetParentPosition() const;
 
 		friend class Actor;
+		friend class ActorTransformsHierarchy;
 		friend class WidgetLayout;
 	};
 
@@ -470,6 +471,8 @@ namespace o2
 		int dirtyFrame = 1;  // Frame index, when layout was marked as dirty
 		int updateFrame = 1; // Frame index, when layout was updated
 
+		int hierarchyIndex = -1; // Index in scene batched transforms hierarchy, -1 when transform isn't batched
+
 		Vec2F position;            // Position @SERIALIZABLE @SERIALIZE_IF(IsSerializeEnabled)
 		Vec2F size;                // Size @SERIALIZABLE @SERIALIZE_IF(IsSerializeEnabled)
 		Vec2F scale = Vec2F(1, 1); // Scale, (1, 1) is default @SERIALIZABLE @SERIALIZE_IF(IsSerializeEnabled)
@@ -692,6 +695,7 @@ CLASS_FIELDS_META(o2::ActorTransformData)
 {
 	FIELD().DEFAULT_VALUE(1).NAME(dirtyFrame).PUBLIC();
 	FIELD().DEFAULT_VALUE(1).NAME(updateFrame).PUBLIC();
+	FIELD().DEFAULT_VALUE(-1).NAME(hierarchyIndex).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(position).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(size).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(Vec2F(1, 1)).NAME(scale).PUBLIC();
@@ -0,0 +1,243 @@
+#include "o2/stdafx.h"
+#include "ActorTransformsHierarchy.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransform.h"
+#include "o2/Scene/UI/Widget.h"
+
+namespace o2
+{
+	ActorTransformsHierarchy::~ActorTransformsHierarchy()
+	{
+		for (auto transform : mTransforms)
+		{
+			if (transform)
+				transform->mData->hierarchyIndex = -1;
+		}
+	}
+
+	void ActorTransformsHierarchy::SetDirty(int index)
+	{
+		mDirty[index] = 1;
+	}
+
+	void ActorTransformsHierarchy::SetHierarchyChanged()
+	{
+		mHierarchyChanged = true;
+	}
+
+	void ActorTransformsHierarchy::Remove(ActorTransform* transform)
+	{
+		int index = transform->mData->hierarchyIndex;
+		if (index < 0)
+			return;
+
+		mTransforms[index] = nullptr;
+		transform->mData->hierarchyIndex = -1;
+
+		mHierarchyChanged = true;
+	}
+
+	void ActorTransformsHierarchy::Update(const Vector<Actor*>& rootActors)
+	{
+		if (mHierarchyChanged)
+			Rebuild(rootActors);
+
+		UpdateLocal();
+		UpdateWorld();
+		ApplyUpdated();
+	}
+
+	bool ActorTransformsHierarchy::TryGetWorldAABB(const ActorTransform* transform, RectF& aabb) const
+	{
+		int index = transform->mData->hierarchyIndex;
+		if (index < 0 || index >= mTransforms.Count() || mTransforms[index] != transform)
+			return false;
+
+		if (mDirty[index] || transform->IsDirty())
+			return false;
+
+		aabb = mWorldAABBs[index];
+		return true;
+	}
+
+	int ActorTransformsHierarchy::GetTransformsCount() const
+	{
+		return mTransforms.Count();
+	}
+
+	void ActorTransformsHierarchy::Rebuild(const Vector<Actor*>& rootActors)
+	{
+		mHierarchyChanged = false;
+
+		for (auto transform : mTransforms)
+		{
+			if (transform)
+				transform->mData->hierarchyIndex = -1;
+		}
+
+		mTransforms.Clear();
+		mParents.Clear();
+		mLocalNonSizedBases.Clear();
+		mLocalBases.Clear();
+		mLocalRectangles.Clear();
+		mPivotOffsets.Clear();
+		mWorldNonSizedBases.Clear();
+		mWorldBases.Clear();
+		mWorldRectangles.Clear();
+		mWorldAABBs.Clear();
+		mDirty.Clear();
+
+		for (auto actor : rootActors)
+			AddActor(actor, -1);
+	}
+
+	void ActorTransformsHierarchy::AddActor(Actor* actor, int parentIndex)
+	{
+		if (dynamic_cast<Widget*>(actor))
+			return;
+
+		ActorTransform* transform = actor->transform;
+		ActorTransformData* data = transform->mData;
+
+		int index = mTransforms.Count();
+		data->hierarchyIndex = index;
+
+		// Not dirty transforms have actual values, they are taken without recalculation
+		mTransforms.Add(transform);
+		mParents.Add(parentIndex);
+		mLocalNonSizedBases.Add(data->nonSizedTransform);
+		mLocalBases.Add(data->transform);
+		mLocalRectangles.Add(data->rectangle);
+		mPivotOffsets.Add(data->size*data->pivot);
+		mWorldNonSizedBases.Add(data->worldNonSizedTransform);
+		mWorldBases.Add(data->worldTransform);
+		mWorldRectangles.Add(data->worldRectangle);
+		mWorldAABBs.Add(data->worldTransform.AABB());
+		mDirty.Add(transform->IsDirty() ? 1 : 0);
+
+		for (auto child : actor->mChildren)
+			AddActor(child, index);
+	}
+
+	void ActorTransformsHierarchy::UpdateLocal()
+	{
+		int count = mTransforms.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (!mDirty[i] || !mTransforms[i])
+				continue;
+
+			const ActorTransformData* data = mTransforms[i]->mData;
+
+			Vec2F pivotOffset = data->size*data->pivot;
+			Vec2F leftBottom = data->position - pivotOffset;
+			Vec2F rightTop = leftBottom + data->size;
+
+			RectF& rectangle = mLocalRectangles[i];
+			rectangle.left = leftBottom.x;
+			rectangle.right = rightTop.x;
+			rectangle.bottom = leftBottom.y;
+			rectangle.top = rightTop.y;
+
+			mPivotOffsets[i] = pivotOffset;
+
+			Basis nonSized = Basis::Build(data->position, data->scale, data->angle, data->shear);
+			Vec2F xv = nonSized.xv*data->size.x, yv = nonSized.yv*data->size.y;
+
+			mLocalNonSizedBases[i] = nonSized;
+			mLocalBases[i].Set(nonSized.origin - xv*data->pivot.x - yv*data->pivot.y, xv, yv);
+		}
+	}
+
+	void ActorTransformsHierarchy::UpdateWorld()
+	{
+		int count = mTransforms.Count();
+		for (int i = 0; i < count; i++)
+		{
+			int parent = mParents[i];
+
+			// Parent is always before child, so its dirty flag and world values are already actual
+			if (parent >= 0 && mDirty[parent])
+				mDirty[i] = 1;
+
+			if (!mDirty[i])
+				continue;
+
+			RectF& worldRectangle = mWorldRectangles[i];
+			const RectF& rectangle = mLocalRectangles[i];
+
+			if (parent >= 0)
+			{
+				Vec2F parentRectanglePosition = mWorldRectangles[parent].LeftBottom() + mPivotOffsets[parent];
+				worldRectangle.left = parentRectanglePosition.x + rectangle.left;
+				worldRectangle.right = parentRectanglePosition.x + rectangle.right;
+				worldRectangle.bottom = parentRectanglePosition.y + rectangle.bottom;
+				worldRectangle.top = parentRectanglePosition.y + rectangle.top;
+
+				mWorldNonSizedBases[i] = mLocalNonSizedBases[i]*mWorldNonSizedBases[parent];
+				mWorldBases[i] = mLocalBases[i]*mWorldNonSizedBases[parent];
+			}
+			else
+			{
+				worldRectangle = rectangle;
+
+				mWorldNonSizedBases[i] = mLocalNonSizedBases[i];
+				mWorldBases[i] = mLocalBases[i];
+			}
+
+			mWorldAABBs[i] = mWorldBases[i].AABB();
+		}
+	}
+
+	void ActorTransformsHierarchy::ApplyUpdated()
+	{
+		mUpdated.Clear();
+
+		int count = mTransforms.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (!mDirty[i])
+				continue;
+
+			mDirty[i] = 0;
+
+			if (!mTransforms[i])
+				continue;
+
+			ActorTransformData* data = mTransforms[i]->mData;
+			int parent = mParents[i];
+
+			data->rectangle = mLocalRectangles[i];
+			data->nonSizedTransform = mLocalNonSizedBases[i];
+			data->transform = mLocalBases[i];
+			data->worldRectangle = mWorldRectangles[i];
+			data->worldNonSizedTransform = mWorldNonSizedBases[i];
+			data->worldTransform = mWorldBases[i];
+
+			if (parent >= 0)
+			{
+				data->parentRectangle = mWorldRectangles[parent];
+				data->parentRectangePosition = mWorldRectangles[parent].LeftBottom() + mPivotOffsets[parent];
+				data->parentTransform = mWorldNonSizedBases[parent];
+			}
+			else
+			{
+				data->parentRectangle = RectF();
+				data->parentRectangePosition = Vec2F();
+				data->parentTransform = Basis::Identity();
+			}
+
+			data->updateFrame = data->dirtyFrame;
+
+			mUpdated.Add(i);
+		}
+
+		// Owners can change transforms and hierarchy in callbacks, so they are notified when all values are written
+		for (auto index : mUpdated)
+		{
+			if (auto transform = mTransforms[index])
+				transform->mData->owner->OnTransformUpdated();
+		}
+	}
+}
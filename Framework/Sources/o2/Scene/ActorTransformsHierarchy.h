@@ -0,0 +1,78 @@
+#pragma once
+
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class ActorTransform;
+
+	// --------------------------------------------------------------------------------------------------------
+	// Batched actors transforms hierarchy. Transforms of scene actors are stored in flat arrays, sorted parent
+	// before child, so dirty world bases, rectangles and AABBs are recomputed in one linear pass without
+	// recursion. Results are written back to actors transforms, so transforms getters work as usual.
+	// Widgets and their children aren't batched, their layouts are updated by widgets
+	// --------------------------------------------------------------------------------------------------------
+	class ActorTransformsHierarchy
+	{
+	public:
+		// Destructor, unbinds batched transforms
+		~ActorTransformsHierarchy();
+
+		// Marks transform with index dirty, it will be updated in next Update()
+		void SetDirty(int index);
+
+		// Marks actors hierarchy changed, transforms order will be rebuilt in next Update()
+		void SetHierarchyChanged();
+
+		// Removes transform from batching
+		void Remove(ActorTransform* transform);
+
+		// Rebuilds transforms order when hierarchy was changed and updates dirty transforms
+		void Update(const Vector<Actor*>& rootActors);
+
+		// Gets batched world axis aligned rectangle of transform. Returns false when transform isn't batched or
+		// it is dirty and wasn't updated yet
+		bool TryGetWorldAABB(const ActorTransform* transform, RectF& aabb) const;
+
+		// Returns count of batched transforms
+		int GetTransformsCount() const;
+
+	protected:
+		Vector<ActorTransform*> mTransforms; // Batched transforms, parents are always before children. Null for removed
+		Vector<int>             mParents;    // Parent transforms indices, -1 for root actors
+
+		Vector<Basis> mLocalNonSizedBases; // Local bases without size
+		Vector<Basis> mLocalBases;         // Local bases
+		Vector<RectF> mLocalRectangles;    // Local rectangles
+		Vector<Vec2F> mPivotOffsets;       // Sizes multiplied by pivots, offsets of children rectangles
+
+		Vector<Basis> mWorldNonSizedBases; // World bases without size
+		Vector<Basis> mWorldBases;         // World bases
+		Vector<RectF> mWorldRectangles;    // World rectangles
+		Vector<RectF> mWorldAABBs;         // World axis aligned rectangles
+
+		Vector<UInt8> mDirty;   // Dirty flags
+		Vector<int>   mUpdated; // Indices of transforms, updated in last Update(). Their owners are notified after update
+
+		bool mHierarchyChanged = true; // Is actors hierarchy changed and transforms order must be rebuilt
+
+	protected:
+		// Rebuilds transforms order from root actors, takes actual values from transforms
+		void Rebuild(const Vector<Actor*>& rootActors);
+
+		// Adds actor transform and its children to batching. Widgets are skipped
+		void AddActor(Actor* actor, int parentIndex);
+
+		// Updates local bases and rectangles of dirty transforms
+		void UpdateLocal();
+
+		// Propagates dirty flags from parents to children and updates world bases and rectangles
+		void UpdateWorld();
+
+		// Writes updated values to transforms and notifies owners
+		void ApplyUpdated();
+	};
+}
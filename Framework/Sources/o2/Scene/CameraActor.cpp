@@ -47,10 +47,7 @@ namespace o2
 		listenersLayer.camera = o2Render.GetCamera();
 
 		for (auto layer : drawLayers.GetLayers())
-		{
-			for (auto comp : layer->mEnabledDrawables)
-				comp->Draw();
-		}
+			layer->Draw();
 
 		o2Render.SetCamera(prevCamera);
 
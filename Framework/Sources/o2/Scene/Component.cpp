@@ -22,6 +22,8 @@ namespace o2
 
 	Component::~Component()
 	{
+		UnregisterUpdating();
+
 		if (mOwner)
 			mOwner->RemoveComponent(this, false);
 
@@ -130,6 +132,21 @@ namespace o2
 		return true;
 	}
 
+	bool Component::IsUpdatable()
+	{
+		return false;
+	}
+
+	bool Component::IsFixedUpdatable()
+	{
+		return false;
+	}
+
+	bool Component::IsParallelUpdatable()
+	{
+		return false;
+	}
+
 	void Component::UpdateEnabled()
 	{
 		bool lastResEnabled = mResEnabled;
@@ -146,11 +163,31 @@ namespace o2
 			else
 				OnDisabled();
 
+			if (mOwner && mOwner->mSceneStatus == Actor::SceneStatus::InScene)
+			{
+				if (mResEnabled)
+					RegisterUpdating();
+				else
+					UnregisterUpdating();
+			}
+
 			if (mOwner)
 				mOwner->OnChanged();
 		}
 	}
 
+	void Component::RegisterUpdating()
+	{
+		if (mResEnabled && mUpdateListIndex < 0)
+			o2Scene.RegisterUpdatableComponent(this);
+	}
+
+	void Component::UnregisterUpdating()
+	{
+		if (mUpdateListIndex >= 0)
+			o2Scene.UnregisterUpdatableComponent(this);
+	}
+
 	void Component::OnSerialize(DataValue& node) const
 	{
 		node.AddMember("mId") = mId;
@@ -36,10 +36,10 @@ namespace o2
 		// Returns component id
 		SceneUID GetID() const;
 
-		// Updates component
+		// Updates component. Scene calls it only when IsUpdatable() returns true for component type
 		virtual void Update(float dt);
 
-		// Updates component with fixed delta time
+		// Updates component with fixed delta time. Scene calls it only when IsFixedUpdatable() returns true for component type
 		virtual void FixedUpdate(float dt);
 
 		// Sets component enable
@@ -94,6 +94,16 @@ namespace o2
 		// Is component visible in create menu
 		static bool IsAvailableFromCreateMenu();
 
+		// Returns is component type requires Update(). Scene updates only components of updatable types
+		static bool IsUpdatable();
+
+		// Returns is component type requires FixedUpdate(). Scene updates only components of updatable types
+		static bool IsFixedUpdatable();
+
+		// Returns is component type Update() thread safe. It must change only component's own data, then scene
+		// updates components of this type in parallel. Scene, actors and other components must not be changed
+		static bool IsParallelUpdatable();
+
 #if IS_EDITOR
 		// It is called when component added from editor
 		virtual void OnAddedFromEditor() {}
@@ -110,6 +120,9 @@ namespace o2
 
 		Vector<ComponentRef*> mReferences; // References to this component
 
+		const Type* mUpdateListType = nullptr; // Type of scene update list, where component is registered
+		int         mUpdateListIndex = -1;     // Index in scene update list, -1 when component isn't registered
+
 	protected:
 		// Beginning serialization callback
 		void OnSerialize(DataValue& node) const override;
@@ -138,6 +151,12 @@ namespace o2
 		// Updates component enable
 		virtual void UpdateEnabled();
 
+		// Registers component in scene update lists when it is enabled
+		void RegisterUpdating();
+
+		// Unregisters component from scene update lists
+		void UnregisterUpdating();
+
 		// Is is called when actor enabled in hierarchy
 		virtual void OnEnabled() {}
 
@@ -246,6 +265,8 @@ CLASS_FIELDS_META(o2::Component)
 	FIELD().EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(mEnabled).PROTECTED();
 	FIELD().DEFAULT_VALUE(true).NAME(mResEnabled).PROTECTED();
 	FIELD().NAME(mReferences).PROTECTED();
+	FIELD().DEFAULT_VALUE(nullptr).NAME(mUpdateListType).PROTECTED();
+	FIELD().DEFAULT_VALUE(-1).NAME(mUpdateListIndex).PROTECTED();
 }
 END_META;
 CLASS_METHODS_META(o2::Component)
@@ -266,6 +287,9 @@ CLASS_METHODS_META(o2::Component)
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableFromCreateMenu);
+	PUBLIC_STATIC_FUNCTION(bool, IsUpdatable);
+	PUBLIC_STATIC_FUNCTION(bool, IsFixedUpdatable);
+	PUBLIC_STATIC_FUNCTION(bool, IsParallelUpdatable);
 	PUBLIC_FUNCTION(void, OnAddedFromEditor);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
@@ -276,6 +300,8 @@ CLASS_METHODS_META(o2::Component)
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PROTECTED_FUNCTION(void, OnStart);
 	PROTECTED_FUNCTION(void, UpdateEnabled);
+	PROTECTED_FUNCTION(void, RegisterUpdating);
+	PROTECTED_FUNCTION(void, UnregisterUpdating);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 	PROTECTED_FUNCTION(void, OnTransformChanged);
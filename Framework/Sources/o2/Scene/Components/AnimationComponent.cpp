@@ -229,6 +229,11 @@ namespace o2
 		return "ui/UI4_animation_component.png";
 	}
 
+	bool AnimationComponent::IsUpdatable()
+	{
+		return true;
+	}
+
 	void AnimationComponent::BeginAnimationEdit()
 	{
 		mInEditMode = true;
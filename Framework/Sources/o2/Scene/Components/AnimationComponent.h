@@ -100,6 +100,9 @@ namespace o2
 		// Returns name of component icon
 		static String GetIcon();
 
+		// Returns true, component requires Update()
+		static bool IsUpdatable();
+
 		SERIALIZABLE(AnimationComponent);
 
 	protected:
@@ -321,6 +324,7 @@ CLASS_METHODS_META(o2::AnimationComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetName);
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
+	PUBLIC_STATIC_FUNCTION(bool, IsUpdatable);
 	PROTECTED_FUNCTION(void, UnregTrack, IAnimationTrack::IPlayer*, const String&);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackAdded, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackRemoved, AnimationState*, IAnimationTrack::IPlayer*);
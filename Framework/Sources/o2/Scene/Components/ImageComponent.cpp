@@ -105,6 +105,7 @@ namespace o2
 	void ImageComponent::OnTransformUpdated()
 	{
 		SetBasis(mOwner->transform->GetWorldBasis());
+		DrawableComponent::OnTransformUpdated();
 	}
 
 	void ImageComponent::SetOwnerActor(Actor* actor)
@@ -48,11 +48,26 @@ namespace o2
 		return "ui/UI4_emitter_component.png";
 	}
 
+	bool ParticlesEmitterComponent::IsUpdatable()
+	{
+		return true;
+	}
+
+	bool ParticlesEmitterComponent::IsParallelUpdatable()
+	{
+		return true;
+	}
+
 	void ParticlesEmitterComponent::OnTransformUpdated()
 	{
 		basis = mOwner->transform->GetWorldBasis();
 	}
 
+	bool ParticlesEmitterComponent::IsSceneDrawableCullable() const
+	{
+		return false;
+	}
+
 	void ParticlesEmitterComponent::OnSerialize(DataValue& node) const
 	{
 		DrawableComponent::OnSerialize(node);
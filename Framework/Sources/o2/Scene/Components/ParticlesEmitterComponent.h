@@ -32,10 +32,19 @@ namespace o2
 		// Returns name of component icon
 		static String GetIcon();
 
+		// Returns true, component requires Update()
+		static bool IsUpdatable();
+
+		// Returns true, particles are updated independently from other components
+		static bool IsParallelUpdatable();
+
 	protected:
 		// It is called when actor's transform was changed
 		void OnTransformUpdated();
 
+		// Returns false, particles are emitted out of actor rectangle
+		bool IsSceneDrawableCullable() const override;
+
 		// Beginning serialization callback
 		void OnSerialize(DataValue& node) const override;
 
@@ -68,7 +77,10 @@ CLASS_METHODS_META(o2::ParticlesEmitterComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetName);
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
+	PUBLIC_STATIC_FUNCTION(bool, IsUpdatable);
+	PUBLIC_STATIC_FUNCTION(bool, IsParallelUpdatable);
 	PROTECTED_FUNCTION(void, OnTransformUpdated);
+	PROTECTED_FUNCTION(bool, IsSceneDrawableCullable);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, OnSerializeDelta, DataValue&, const IObject&);
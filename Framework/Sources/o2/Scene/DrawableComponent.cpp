@@ -2,6 +2,7 @@
 #include "DrawableComponent.h"
 
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/SceneLayer.h"
 
@@ -83,6 +84,28 @@ namespace o2
 		return mResEnabled;
 	}
 
+	bool DrawableComponent::IsSceneDrawableCullable() const
+	{
+		return true;
+	}
+
+	RectF DrawableComponent::GetSceneDrawableAABB() const
+	{
+		if (auto hierarchy = o2Scene.GetTransformsHierarchy())
+		{
+			RectF aabb;
+			if (hierarchy->TryGetWorldAABB(mOwner->transform, aabb))
+				return aabb;
+		}
+
+		return mOwner->transform->GetWorldBasis().AABB();
+	}
+
+	void DrawableComponent::OnTransformUpdated()
+	{
+		OnSceneDrawableBoundsChanged();
+	}
+
 	void DrawableComponent::OnAddToScene()
 	{
 		ISceneDrawable::OnAddToScene();
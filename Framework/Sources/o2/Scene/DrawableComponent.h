@@ -50,6 +50,15 @@ namespace o2
 		// Returns is drawable enabled
 		bool IsSceneDrawableEnabled() const override;
 
+		// Returns true, component draws inside owner actor world rectangle
+		bool IsSceneDrawableCullable() const override;
+
+		// Returns owner actor world axis aligned rectangle
+		RectF GetSceneDrawableAABB() const override;
+
+		// It is called when owner actor transform was updated, updates culling bounds
+		void OnTransformUpdated() override;
+
 		// It is called when actor was included to scene
 		void OnAddToScene();
 
@@ -87,6 +96,9 @@ CLASS_METHODS_META(o2::DrawableComponent)
 	PROTECTED_FUNCTION(void, UpdateEnabled);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(bool, IsSceneDrawableCullable);
+	PROTECTED_FUNCTION(RectF, GetSceneDrawableAABB);
+	PROTECTED_FUNCTION(void, OnTransformUpdated);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PUBLIC_FUNCTION(SceneEditableObject*, GetEditableOwner);
@@ -50,7 +50,26 @@ namespace o2
 	void ISceneDrawable::OnDisabled()
 	{
 		if (auto layer = GetSceneDrawableSceneLayer())
-			layer->OnDrawableEnabled(this);
+			layer->OnDrawableDisabled(this);
+	}
+
+	bool ISceneDrawable::IsSceneDrawableCullable() const
+	{
+		return false;
+	}
+
+	RectF ISceneDrawable::GetSceneDrawableAABB() const
+	{
+		return RectF();
+	}
+
+	void ISceneDrawable::OnSceneDrawableBoundsChanged()
+	{
+		if (mCullingProxy < 0 || mCullingBoundsChanged)
+			return;
+
+		if (auto layer = GetSceneDrawableSceneLayer())
+			layer->OnDrawableBoundsChanged(this);
 	}
 
 	void ISceneDrawable::OnAddToScene()
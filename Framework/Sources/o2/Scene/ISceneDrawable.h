@@ -52,6 +52,10 @@ namespace o2
 	protected:
 		float mDrawingDepth = 0.0f; // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
 
+		int  mCullingProxy = -1;            // Layer culling tree proxy, -1 when drawable isn't in tree
+		int  mLayerDrawOrder = 0;           // Index in layer enabled drawables, used for ordering visible drawables
+		bool mCullingBoundsChanged = false; // Is bounds changed and culling tree proxy must be updated
+
 	protected:
 		// Returns current scene layer
 		virtual SceneLayer* GetSceneDrawableSceneLayer() const = 0;
@@ -59,6 +63,15 @@ namespace o2
 		// Returns is drawable enabled
 		virtual bool IsSceneDrawableEnabled() const = 0;
 
+		// Returns true when drawable draws inside GetSceneDrawableAABB() and can be culled by camera
+		virtual bool IsSceneDrawableCullable() const;
+
+		// Returns world axis aligned bounds of drawable, used for culling
+		virtual RectF GetSceneDrawableAABB() const;
+
+		// It is called when drawable bounds were changed, updates layer culling tree
+		void OnSceneDrawableBoundsChanged();
+
 		// Is is called when drawable has enabled
 		void OnEnabled();
 
@@ -95,6 +108,9 @@ CLASS_FIELDS_META(o2::ISceneDrawable)
 {
 	FIELD().NAME(drawDepth).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(mDrawingDepth).PROTECTED();
+	FIELD().DEFAULT_VALUE(-1).NAME(mCullingProxy).PROTECTED();
+	FIELD().DEFAULT_VALUE(0).NAME(mLayerDrawOrder).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mCullingBoundsChanged).PROTECTED();
 }
 END_META;
 CLASS_METHODS_META(o2::ISceneDrawable)
@@ -106,6 +122,9 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	PUBLIC_FUNCTION(void, SetLastOnCurrentDepth);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(bool, IsSceneDrawableCullable);
+	PROTECTED_FUNCTION(RectF, GetSceneDrawableAABB);
+	PROTECTED_FUNCTION(void, OnSceneDrawableBoundsChanged);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 	PROTECTED_FUNCTION(void, OnAddToScene);
@@ -85,7 +85,7 @@ namespace o2
 
 	void BoxCollider::OnTransformChanged()
 	{
-		if (!o2Physics.IsUpdatingPhysicsNow() && mFitByActor)
+		if (!o2Physics.IsSyncingTransformsNow() && mFitByActor)
 			FitSize();
 
 		ICollider::OnTransformChanged();
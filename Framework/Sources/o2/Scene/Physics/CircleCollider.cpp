@@ -76,7 +76,7 @@ namespace o2
 
 	void CircleCollider::OnTransformChanged()
 	{
-		if (!o2Physics.IsUpdatingPhysicsNow() && mFitByActor)
+		if (!o2Physics.IsSyncingTransformsNow() && mFitByActor)
 		{
 			float prevRadius = mRadius;
 			mRadius = mOwner->transform->GetSize().x*0.5f;
@@ -173,7 +173,7 @@ namespace o2
 
 	void ICollider::OnTransformChanged()
 	{
-		if (!o2Physics.IsUpdatingPhysicsNow())
+		if (!o2Physics.IsSyncingTransformsNow())
 			OnShapeChanged();
 	}
 
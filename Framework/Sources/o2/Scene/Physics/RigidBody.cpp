@@ -2,6 +2,7 @@
 #include "RigidBody.h"
 
 #include "Box2D/Dynamics/b2Body.h"
+#include "o2/Config/ProjectConfig.h"
 #include "o2/Physics/PhysicsWorld.h"
 #include "o2/Scene/Physics/ICollider.h"
 
@@ -217,10 +218,52 @@ namespace o2
 		Actor::OnRemoveFromScene();
 	}
 
+	void RigidBody::OnTransformChanged()
+	{
+		Actor::OnTransformChanged();
+
+		if (mBody && !o2Physics.IsSyncingTransformsNow())
+			o2Physics.OnBodyTransformChanged(this);
+	}
+
+	void RigidBody::OnTransformUpdated()
+	{
+		Actor::OnTransformUpdated();
+
+		if (!mBody || mTransformChanged || o2Physics.IsSyncingTransformsNow())
+			return;
+
+		const float positionEpsilon = 0.000001f;
+		const float angleThreshold = 0.0001f;
+		const double fullTurn = 6.283185307179586;
+
+		Vec2F position = transform->GetWorldPosition();
+
+		// Synced position is read back from transform, so threshold covers only few float ulps of coordinates
+		float positionThreshold = positionEpsilon*Math::Max(1.0f, Math::Max(Math::Abs(position.x), Math::Abs(position.y)));
+
+		// Body angle isn't wrapped and can be large, so angles are compared by modulo of full turn in double precision
+		float angleDelta = (float)Math::Abs(std::remainder((double)transform->GetWorldAngle() - mSyncedAngle, fullTurn));
+
+		if ((position - mSyncedPosition).SqrLength() > positionThreshold*positionThreshold || angleDelta > angleThreshold)
+		{
+			o2Physics.OnBodyTransformChanged(this);
+		}
+	}
+
 	void RigidBody::CreateBody()
 	{
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		mSyncedPosition = transform->GetWorldPosition();
+		mSyncedAngle = transform->GetWorldAngle();
+		mPhysicsPosition = mPrevPhysicsPosition = mSyncedPosition;
+		mPhysicsAngle = mPrevPhysicsAngle = mSyncedAngle;
+		mWasAwake = true;
+
 		b2BodyDef def;
-		def.position = transform->GetWorldPosition();
+		def.position = mSyncedPosition*invScale;
+		def.angle = mSyncedAngle;
 		def.userData = this;
 		def.active = mResEnabledInHierarchy;
 
@@ -241,6 +284,7 @@ namespace o2
 	{
 		if (mBody)
 		{
+			PhysicsWorld::Instance().OnBodyRemoved(this);
 			PhysicsWorld::Instance().mWorld.DestroyBody(mBody);
 			mBody = nullptr;
 		}
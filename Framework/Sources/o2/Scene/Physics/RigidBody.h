@@ -126,6 +126,18 @@ namespace o2
 
 		Vector<ICollider*> mColliders; // Attached colliders list
 
+		Vec2F mSyncedPosition;           // World position, synchronized with body last time
+		float mSyncedAngle = 0.0f;       // World angle, synchronized with body last time
+		bool  mTransformChanged = false; // Is transform changed outside physics and must be pushed to body
+		bool  mWasAwake = false;         // Was body awake after last physics step
+
+		Vec2F mPhysicsPosition;         // World position of body after last physics step
+		float mPhysicsAngle = 0.0f;     // World angle of body after last physics step
+		Vec2F mPrevPhysicsPosition;     // World position of body after previous physics step
+		float mPrevPhysicsAngle = 0.0f; // World angle of body after previous physics step
+		bool  mIsMoving = false;        // Is body moved in last physics step
+		bool  mIsInterpolated = false;  // Is body in physics world interpolated bodies list
+
 	protected:
 		// It is called when result enable was changed
 		void OnEnableInHierarchyChanged() override;
@@ -136,6 +148,13 @@ namespace o2
 		// It is called when actor has removed from scene; destroys rigid body
 		void OnRemoveFromScene() override;
 
+		// It is called when transformation was changed, marks body to synchronize with physics
+		void OnTransformChanged() override;
+
+		// It is called when transformation was updated. Marks body to synchronize when world position or angle
+		// differs from synchronized with physics. It catches changes by parents, that don't call OnTransformChanged
+		void OnTransformUpdated() override;
+
 		// Creates box2d body, registers in physics world
 		void CreateBody();
 
@@ -187,6 +206,16 @@ CLASS_FIELDS_META(o2::RigidBody)
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mIsBullet).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mIsFixedRotation).PROTECTED();
 	FIELD().NAME(mColliders).PROTECTED();
+	FIELD().NAME(mSyncedPosition).PROTECTED();
+	FIELD().DEFAULT_VALUE(0.0f).NAME(mSyncedAngle).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mTransformChanged).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mWasAwake).PROTECTED();
+	FIELD().NAME(mPhysicsPosition).PROTECTED();
+	FIELD().DEFAULT_VALUE(0.0f).NAME(mPhysicsAngle).PROTECTED();
+	FIELD().NAME(mPrevPhysicsPosition).PROTECTED();
+	FIELD().DEFAULT_VALUE(0.0f).NAME(mPrevPhysicsAngle).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mIsMoving).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mIsInterpolated).PROTECTED();
 }
 END_META;
 CLASS_METHODS_META(o2::RigidBody)
@@ -217,6 +246,8 @@ CLASS_METHODS_META(o2::RigidBody)
 	PROTECTED_FUNCTION(void, OnEnableInHierarchyChanged);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
+	PROTECTED_FUNCTION(void, OnTransformChanged);
+	PROTECTED_FUNCTION(void, OnTransformUpdated);
 	PROTECTED_FUNCTION(void, CreateBody);
 	PROTECTED_FUNCTION(void, RemoveBody);
 	PROTECTED_FUNCTION(void, AddCollider, ICollider*);
@@ -1,11 +1,13 @@
 #include "o2/stdafx.h"
 #include "Scene.h"
 
+#include "o2/Application/Application.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ActorRefResolver.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 #include "o2/Scene/CameraActor.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/DrawableComponent.h"
@@ -13,6 +15,9 @@
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
+#include "o2/Utils/Tasks/JobSystem.h"
+#include "o2/Utils/Types/Containers/ArenaVector.h"
 #include "o2/Render/VectorFontEffects.h"
 
 namespace o2
@@ -32,6 +37,10 @@ namespace o2
 		ClearCache();
 
 		delete mDefaultLayer;
+		delete mTransformsHierarchy;
+
+		for (auto& kv : mComponentsUpdateListsByType)
+			delete kv.second;
 	}
 
 	const o2::Vector<CameraActor*>& Scene::GetCameras() const
@@ -44,21 +53,28 @@ namespace o2
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
+
+		if (mTransformsHierarchy)
+			mTransformsHierarchy->Update(mRootActors);
+
 		UpdateActors(dt);
+		UpdateComponents(dt);
 	}
 
 	void Scene::FixedUpdate(float dt)
 	{
 		for (auto actor : mRootActors)
+		{
 			actor->FixedUpdate(dt);
-
-		for (auto actor : mRootActors)
 			actor->FixedUpdateChildren(dt);
+		}
+
+		FixedUpdateComponents(dt);
 	}
 
 	void Scene::UpdateAddedEntities()
 	{
-		auto addedActors = mAddedActors;
+		ArenaVector<Actor*> addedActors(o2Application.GetFrameAllocator(), mAddedActors);
 
 		mStartActors = mAddedActors;
 
@@ -70,8 +86,9 @@ namespace o2
 
 	void Scene::UpdateStartingEntities()
 	{
-		auto startActors = mStartActors;
-		auto startComponents = mStartComponents;
+		FrameAllocator& frameAllocator = o2Application.GetFrameAllocator();
+		ArenaVector<Actor*> startActors(frameAllocator, mStartActors);
+		ArenaVector<Component*> startComponents(frameAllocator, mStartComponents);
 
 		mStartActors.Clear();
 		mStartComponents.Clear();
@@ -85,8 +102,9 @@ namespace o2
 
 	void Scene::UpdateDestroyingEntities()
 	{
-		auto destroyActors = mDestroyActors;
-		auto destroyComponents = mDestroyComponents;
+		FrameAllocator& frameAllocator = o2Application.GetFrameAllocator();
+		ArenaVector<Actor*> destroyActors(frameAllocator, mDestroyActors);
+		ArenaVector<Component*> destroyComponents(frameAllocator, mDestroyComponents);
 
 		mDestroyActors.Clear();
 		mDestroyComponents.Clear();
@@ -99,7 +117,7 @@ namespace o2
 
 		if constexpr (IS_EDITOR)
 		{
-			auto destroyingObjects = mDestroyingObjects;
+			ArenaVector<SceneEditableObject*> destroyingObjects(frameAllocator, mDestroyingObjects);
 			mDestroyingObjects.Clear();
 
 			for (auto object : destroyingObjects)
@@ -109,14 +127,42 @@ namespace o2
 
 	void Scene::DestroyActor(Actor* actor)
 	{
+		Assert(!mIsParallelUpdating, "Scene can't be changed while components are updating in parallel");
+
 		mDestroyActors.Add(actor);
 	}
 
 	void Scene::DestroyComponent(Component* component)
 	{
+		Assert(!mIsParallelUpdating, "Scene can't be changed while components are updating in parallel");
+
 		mDestroyComponents.Add(component);
 	}
 
+	void Scene::SetTransformsBatchingEnabled(bool enabled)
+	{
+		if (enabled == IsTransformsBatchingEnabled())
+			return;
+
+		if (enabled)
+			mTransformsHierarchy = mnew ActorTransformsHierarchy();
+		else
+		{
+			delete mTransformsHierarchy;
+			mTransformsHierarchy = nullptr;
+		}
+	}
+
+	bool Scene::IsTransformsBatchingEnabled() const
+	{
+		return mTransformsHierarchy != nullptr;
+	}
+
+	ActorTransformsHierarchy* Scene::GetTransformsHierarchy() const
+	{
+		return mTransformsHierarchy;
+	}
+
 	void Scene::AddActorToSceneDeferred(Actor* actor)
 	{
 		mAddedActors.Add(actor);
@@ -128,6 +174,12 @@ namespace o2
 		mActorsMap[actor->mId] = actor;
 	}
 
+	void Scene::OnActorParentChanged(Actor* actor)
+	{
+		if (mTransformsHierarchy)
+			mTransformsHierarchy->SetHierarchyChanged();
+	}
+
 	void Scene::DestroyEditableObject(SceneEditableObject* object)
 	{
 		mDestroyingObjects.Add(object);
@@ -136,10 +188,99 @@ namespace o2
 	void Scene::UpdateActors(float dt)
 	{
 		for (auto actor : mRootActors)
+		{
 			actor->Update(dt);
-
-		for (auto actor : mRootActors)
 			actor->UpdateChildren(dt);
+		}
+	}
+
+	void Scene::UpdateComponents(float dt)
+	{
+		// Components can be added, disabled or removed while updating, so lists are iterated by indices
+		for (int i = 0; i < mComponentsUpdateLists.Count(); i++)
+		{
+			auto list = mComponentsUpdateLists[i];
+			if (!list->isUpdatable)
+				continue;
+
+			if (list->isParallelUpdatable && JobSystem::IsSingletonInitialzed())
+			{
+				auto& components = list->components;
+
+				mIsParallelUpdating = true;
+				o2Jobs.ParallelFor(components.Count(), [&](int idx) { components[idx]->Update(dt); }, mParallelUpdateBatchSize);
+				mIsParallelUpdating = false;
+
+				continue;
+			}
+
+			for (int j = 0; j < list->components.Count(); j++)
+				list->components[j]->Update(dt);
+		}
+	}
+
+	void Scene::FixedUpdateComponents(float dt)
+	{
+		for (int i = 0; i < mComponentsUpdateLists.Count(); i++)
+		{
+			auto list = mComponentsUpdateLists[i];
+			if (!list->isFixedUpdatable)
+				continue;
+
+			for (int j = 0; j < list->components.Count(); j++)
+				list->components[j]->FixedUpdate(dt);
+		}
+	}
+
+	Scene::ComponentsUpdateList* Scene::GetComponentsUpdateList(const Type* type)
+	{
+		ComponentsUpdateList* list = nullptr;
+		if (mComponentsUpdateListsByType.TryGetValue(type, list))
+			return list;
+
+		list = mnew ComponentsUpdateList();
+		list->type = type;
+		list->isUpdatable = type->InvokeStatic<bool>("IsUpdatable");
+		list->isFixedUpdatable = type->InvokeStatic<bool>("IsFixedUpdatable");
+		list->isParallelUpdatable = type->InvokeStatic<bool>("IsParallelUpdatable");
+
+		mComponentsUpdateListsByType.Add(type, list);
+
+		if (list->isUpdatable || list->isFixedUpdatable)
+			mComponentsUpdateLists.Add(list);
+
+		return list;
+	}
+
+	void Scene::RegisterUpdatableComponent(Component* component)
+	{
+		Assert(!mIsParallelUpdating, "Scene can't be changed while components are updating in parallel");
+
+		auto list = GetComponentsUpdateList(&component->GetType());
+		if (!list->isUpdatable && !list->isFixedUpdatable)
+			return;
+
+		component->mUpdateListType = list->type;
+		component->mUpdateListIndex = list->components.Count();
+		list->components.Add(component);
+	}
+
+	void Scene::UnregisterUpdatableComponent(Component* component)
+	{
+		Assert(!mIsParallelUpdating, "Scene can't be changed while components are updating in parallel");
+
+		ComponentsUpdateList* list = nullptr;
+		if (!mComponentsUpdateListsByType.TryGetValue(component->mUpdateListType, list))
+			return;
+
+		// Swap with last component, order of components inside type list doesn't matter
+		Component* last = list->components.Last();
+		list->components[component->mUpdateListIndex] = last;
+		last->mUpdateListIndex = component->mUpdateListIndex;
+		list->components.PopBack();
+
+		component->mUpdateListType = nullptr;
+		component->mUpdateListIndex = -1;
 	}
 
 #undef DrawText
@@ -248,6 +389,9 @@ namespace o2
 		mAllActors.Add(actor);
 		mActorsMap[actor->mId] = actor;
 
+		if (mTransformsHierarchy)
+			mTransformsHierarchy->SetHierarchyChanged();
+
 		actor->OnAddToScene();
 
 		if constexpr (IS_EDITOR)
@@ -266,6 +410,9 @@ namespace o2
 		mAllActors.Remove(actor);
 		mActorsMap.Remove(actor->mId);
 
+		if (mTransformsHierarchy)
+			mTransformsHierarchy->Remove(actor->transform);
+
 		mStartActors.Remove(actor);
 		mAddedActors.Remove(actor);
 
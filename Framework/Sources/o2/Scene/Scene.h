@@ -14,6 +14,7 @@
 namespace o2
 {
 	class Actor;
+	class ActorTransformsHierarchy;
 	class CameraActor;
 	class Component;
 	class SceneLayer;
@@ -162,8 +163,31 @@ namespace o2
 		// Adds component to destroy list, will be removed at next frame
 		void DestroyComponent(Component* component);
 
+		// Enables or disables batched transforms: scene actors transforms are updated in flat hierarchy in one pass
+		void SetTransformsBatchingEnabled(bool enabled);
+
+		// Returns is batched transforms enabled
+		bool IsTransformsBatchingEnabled() const;
+
+		// Returns batched transforms hierarchy, null when batching is disabled
+		ActorTransformsHierarchy* GetTransformsHierarchy() const;
+
 		IOBJECT(Scene);
 
+	protected:
+		// -----------------------------------------------------------------------------------------------
+		// Enabled scene components of one type. Components are updated grouped by type, without visiting
+		// actors tree and components, that don't need updating
+		// -----------------------------------------------------------------------------------------------
+		struct ComponentsUpdateList
+		{
+			const Type*        type = nullptr;              // Components type
+			bool               isUpdatable = false;         // Is components type requires Update
+			bool               isFixedUpdatable = false;    // Is components type requires FixedUpdate
+			bool               isParallelUpdatable = false; // Is components of type can be updated in parallel
+			Vector<Component*> components;                  // Registered components
+		};
+
 	protected:
 		Vector<CameraActor*> mCameras; // List of cameras on scene
 
@@ -180,6 +204,14 @@ namespace o2
 		Vector<Actor*>     mDestroyActors;     // List of destroying on current frame actors
 		Vector<Component*> mDestroyComponents; // List of destroying on current frame components
 
+		Map<const Type*, ComponentsUpdateList*> mComponentsUpdateListsByType; // Components update lists by type. Also caches not updatable types
+		Vector<ComponentsUpdateList*>           mComponentsUpdateLists;       // Update lists of updatable components types
+
+		int  mParallelUpdateBatchSize = 32; // Count of components, updated by one job in parallel update
+		bool mIsParallelUpdating = false;   // Is components updating in parallel now. Scene must not be changed at this time
+
+		ActorTransformsHierarchy* mTransformsHierarchy = nullptr; // Batched transforms hierarchy, null when batching is disabled
+
 		Map<String, SceneLayer*> mLayersMap;    // Layers by names map
 		Vector<SceneLayer*>      mLayers;       // Scene layers
 		SceneLayer*              mDefaultLayer; // Default scene layer
@@ -201,6 +233,22 @@ namespace o2
 		// Updates root actors and their children
 		void UpdateActors(float dt);
 
+		// Updates registered components of updatable types. Components of parallel updatable types are
+		// updated on job system threads, other components are updated on main thread
+		void UpdateComponents(float dt);
+
+		// Updates registered components of fixed updatable types
+		void FixedUpdateComponents(float dt);
+
+		// Returns components update list for type, creates it when required
+		ComponentsUpdateList* GetComponentsUpdateList(const Type* type);
+
+		// Registers component in update list of its type, if type requires updating
+		void RegisterUpdatableComponent(Component* component);
+
+		// Unregisters component from update list
+		void UnregisterUpdatableComponent(Component* component);
+
 		// Updates just added actors and components
 		void UpdateAddedEntities();
 
@@ -222,6 +270,9 @@ namespace o2
 		// It is called when actor unique id was changed; updates actors map
 		void OnActorIdChanged(Actor* actor, SceneUID prevId);
 
+		// It is called when scene actor parent was changed; batched transforms order will be rebuilt
+		void OnActorParentChanged(Actor* actor);
+
 		// It is called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
@@ -401,6 +452,11 @@ CLASS_FIELDS_META(o2::Scene)
 	FIELD().NAME(mStartComponents).PROTECTED();
 	FIELD().NAME(mDestroyActors).PROTECTED();
 	FIELD().NAME(mDestroyComponents).PROTECTED();
+	FIELD().NAME(mComponentsUpdateListsByType).PROTECTED();
+	FIELD().NAME(mComponentsUpdateLists).PROTECTED();
+	FIELD().DEFAULT_VALUE(32).NAME(mParallelUpdateBatchSize).PROTECTED();
+	FIELD().DEFAULT_VALUE(false).NAME(mIsParallelUpdating).PROTECTED();
+	FIELD().DEFAULT_VALUE(nullptr).NAME(mTransformsHierarchy).PROTECTED();
 	FIELD().NAME(mLayersMap).PROTECTED();
 	FIELD().NAME(mLayers).PROTECTED();
 	FIELD().NAME(mDefaultLayer).PROTECTED();
@@ -455,8 +511,16 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(void, UpdateDestroyingEntities);
 	PUBLIC_FUNCTION(void, DestroyActor, Actor*);
 	PUBLIC_FUNCTION(void, DestroyComponent, Component*);
+	PUBLIC_FUNCTION(void, SetTransformsBatchingEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsTransformsBatchingEnabled);
+	PUBLIC_FUNCTION(ActorTransformsHierarchy*, GetTransformsHierarchy);
 	PROTECTED_FUNCTION(void, DrawCameras, bool);
 	PROTECTED_FUNCTION(void, UpdateActors, float);
+	PROTECTED_FUNCTION(void, UpdateComponents, float);
+	PROTECTED_FUNCTION(void, FixedUpdateComponents, float);
+	PROTECTED_FUNCTION(ComponentsUpdateList*, GetComponentsUpdateList, const Type*);
+	PROTECTED_FUNCTION(void, RegisterUpdatableComponent, Component*);
+	PROTECTED_FUNCTION(void, UnregisterUpdatableComponent, Component*);
 	PROTECTED_FUNCTION(void, UpdateAddedEntities);
 	PROTECTED_FUNCTION(void, UpdateStartingEntities);
 	PROTECTED_FUNCTION(void, DrawCursorDebugInfo);
@@ -464,6 +528,7 @@ CLASS_METHODS_META(o2::Scene)
 	PROTECTED_FUNCTION(void, AddActorToSceneDeferred, Actor*);
 	PROTECTED_FUNCTION(void, RemoveActorFromScene, Actor*, bool);
 	PROTECTED_FUNCTION(void, OnActorIdChanged, Actor*, SceneUID);
+	PROTECTED_FUNCTION(void, OnActorParentChanged, Actor*);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoved, Component*);
 	PROTECTED_FUNCTION(void, OnLayerRenamed, SceneLayer*, const String&);
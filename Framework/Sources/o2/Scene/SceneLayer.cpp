@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "SceneLayer.h"
 
+#include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Scene/Scene.h"
@@ -43,6 +44,68 @@ namespace o2
 		return mEnabledDrawables;
 	}
 
+	void SceneLayer::SetDrawsSortingEnabled(bool enabled)
+	{
+		mDrawsSorting = enabled;
+	}
+
+	bool SceneLayer::IsDrawsSortingEnabled() const
+	{
+		return mDrawsSorting;
+	}
+
+	void SceneLayer::SetCullingEnabled(bool enabled)
+	{
+		if (mCulling == enabled)
+			return;
+
+		mCulling = enabled;
+		RebuildCulling();
+	}
+
+	bool SceneLayer::IsCullingEnabled() const
+	{
+		return mCulling;
+	}
+
+	int SceneLayer::GetVisibleDrawablesCount() const
+	{
+		return mVisibleDrawablesCount;
+	}
+
+	int SceneLayer::GetCulledDrawablesCount() const
+	{
+		return mCulledDrawablesCount;
+	}
+
+	void SceneLayer::Draw()
+	{
+		if (mDrawsSorting)
+			o2Render.BeginDrawsSorting();
+
+		if (mCulling)
+		{
+			CollectVisibleDrawables(o2Render.GetCamera().GetAxisAlignedRect());
+
+			for (auto drawable : mVisibleDrawables)
+				drawable->Draw();
+
+			mVisibleDrawablesCount = mVisibleDrawables.Count();
+			mCulledDrawablesCount = mEnabledDrawables.Count() - mVisibleDrawablesCount;
+		}
+		else
+		{
+			for (auto drawable : mEnabledDrawables)
+				drawable->Draw();
+
+			mVisibleDrawablesCount = mEnabledDrawables.Count();
+			mCulledDrawablesCount = 0;
+		}
+
+		if (mDrawsSorting)
+			o2Render.EndDrawsSorting();
+	}
+
 	void SceneLayer::RegisterActor(Actor* actor)
 	{
 		mActors.Add(actor);
@@ -75,11 +138,33 @@ namespace o2
 
 	void SceneLayer::OnDrawableDepthChanged(ISceneDrawable* drawable)
 	{
-		OnDrawableDisabled(drawable);
-		OnDrawableEnabled(drawable);
+		if (!mEnabledDrawables.Contains(drawable))
+			return;
+
+		mEnabledDrawables.Remove(drawable);
+		InsertEnabledDrawable(drawable);
+		mDrawOrderChanged = true;
 	}
 
 	void SceneLayer::OnDrawableEnabled(ISceneDrawable* drawable)
+	{
+		InsertEnabledDrawable(drawable);
+		mDrawOrderChanged = true;
+
+		if (mCulling)
+			AddCullingDrawable(drawable);
+	}
+
+	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
+	{
+		mEnabledDrawables.Remove(drawable);
+		mDrawOrderChanged = true;
+
+		if (mCulling)
+			RemoveCullingDrawable(drawable);
+	}
+
+	void SceneLayer::InsertEnabledDrawable(ISceneDrawable* drawable)
 	{
 		const int binSearchRangeSizeStop = 5;
 		int rangeMin = 0, rangeMax = mEnabledDrawables.Count();
@@ -115,14 +200,10 @@ namespace o2
 		mEnabledDrawables.Insert(drawable, position);
 	}
 
-	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
-	{
-		mEnabledDrawables.Remove(drawable);
-	}
-
 	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
 	{
-		OnDrawableDisabled(drawable);
+		mEnabledDrawables.Remove(drawable);
+		mDrawOrderChanged = true;
 
 		for (int position = 0; position < mEnabledDrawables.Count(); position++)
 		{
@@ -136,6 +217,101 @@ namespace o2
 		mEnabledDrawables.Add(drawable);
 	}
 
+	void SceneLayer::OnDrawableBoundsChanged(ISceneDrawable* drawable)
+	{
+		drawable->mCullingBoundsChanged = true;
+		mChangedBoundsDrawables.Add(drawable);
+	}
+
+	void SceneLayer::AddCullingDrawable(ISceneDrawable* drawable)
+	{
+		if (!drawable->IsSceneDrawableCullable())
+		{
+			mNotCullableDrawables.Add(drawable);
+			return;
+		}
+
+		if (drawable->mCullingProxy < 0)
+			drawable->mCullingProxy = mCullingTree.Add(drawable->GetSceneDrawableAABB(), drawable);
+	}
+
+	void SceneLayer::RemoveCullingDrawable(ISceneDrawable* drawable)
+	{
+		if (drawable->mCullingProxy >= 0)
+		{
+			mCullingTree.Remove(drawable->mCullingProxy);
+			drawable->mCullingProxy = -1;
+		}
+		else
+			mNotCullableDrawables.Remove(drawable);
+
+		if (drawable->mCullingBoundsChanged)
+		{
+			mChangedBoundsDrawables.Remove(drawable);
+			drawable->mCullingBoundsChanged = false;
+		}
+	}
+
+	void SceneLayer::RebuildCulling()
+	{
+		for (auto drawable : mEnabledDrawables)
+		{
+			drawable->mCullingProxy = -1;
+			drawable->mCullingBoundsChanged = false;
+		}
+
+		mCullingTree.Clear();
+		mNotCullableDrawables.Clear();
+		mChangedBoundsDrawables.Clear();
+		mVisibleDrawables.Clear();
+		mDrawOrderChanged = true;
+
+		if (!mCulling)
+			return;
+
+		for (auto drawable : mEnabledDrawables)
+			AddCullingDrawable(drawable);
+	}
+
+	void SceneLayer::UpdateCullingBounds()
+	{
+		for (auto drawable : mChangedBoundsDrawables)
+		{
+			drawable->mCullingBoundsChanged = false;
+
+			if (drawable->mCullingProxy >= 0)
+				mCullingTree.Move(drawable->mCullingProxy, drawable->GetSceneDrawableAABB());
+		}
+
+		mChangedBoundsDrawables.Clear();
+	}
+
+	void SceneLayer::CollectVisibleDrawables(const RectF& rect)
+	{
+		UpdateCullingBounds();
+
+		// Draw order indices are updated only when enabled drawables order changes, they are used to restore depth order of visible drawables
+		if (mDrawOrderChanged)
+		{
+			for (int i = 0; i < mEnabledDrawables.Count(); i++)
+				mEnabledDrawables[i]->mLayerDrawOrder = i;
+
+			mDrawOrderChanged = false;
+		}
+
+		mVisibleDrawables.Clear();
+		mCullingTree.Query(rect, [&](void* userData) { mVisibleDrawables.Add((ISceneDrawable*)userData); });
+		mVisibleDrawables.Add(mNotCullableDrawables);
+
+		std::sort(mVisibleDrawables.begin(), mVisibleDrawables.end(),
+				  [](ISceneDrawable* a, ISceneDrawable* b) { return a->mLayerDrawOrder < b->mLayerDrawOrder; });
+	}
+
+	void SceneLayer::OnDeserialized(const DataValue& node)
+	{
+		RebuildCulling();
+	}
+
 
 // 	void LayerDataValueConverter::ToData(void* object, DataValue& data)
 // 	{
@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Serialization/Serializable.h"
+#include "o2/Utils/Tools/AABBTree.h"
 
 namespace o2
 {
@@ -36,17 +37,49 @@ namespace o2
 		// Returns enabled drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Sets draws sorting enabled. When enabled, not overlapping drawables are reordered by texture to reduce draw calls
+		void SetDrawsSortingEnabled(bool enabled);
+
+		// Returns is draws sorting enabled
+		bool IsDrawsSortingEnabled() const;
+
+		// Sets culling enabled. When enabled, only drawables intersecting current camera rectangle are drawn
+		void SetCullingEnabled(bool enabled);
+
+		// Returns is culling enabled
+		bool IsCullingEnabled() const;
+
+		// Returns count of drawn drawables in last Draw()
+		int GetVisibleDrawablesCount() const;
+
+		// Returns count of culled drawables in last Draw()
+		int GetCulledDrawablesCount() const;
+
+		// Draws enabled drawables. When culling is enabled, drawables out of current camera rectangle are skipped
+		void Draw();
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
 		String mName; // Name of layer @SERIALIZABLE
 
+		bool mDrawsSorting = false; // Is drawables reordering by texture enabled @SERIALIZABLE
+		bool mCulling = false;      // Is drawables culling by camera enabled @SERIALIZABLE
+
 		Vector<Actor*>  mActors;        // Actors in layer
 		Vector<Actor*>  mEnabledActors; // Enabled actors
 
 		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
 		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
 
+		AABBTree                mCullingTree;                // Bounds tree of enabled cullable drawables
+		Vector<ISceneDrawable*> mNotCullableDrawables;       // Enabled drawables, that can't be culled and are always drawn
+		Vector<ISceneDrawable*> mChangedBoundsDrawables;     // Drawables with changed bounds, their proxies are updated before drawing
+		Vector<ISceneDrawable*> mVisibleDrawables;           // Visible drawables buffer, sorted by draw order
+		bool                    mDrawOrderChanged = true;    // Is enabled drawables order changed and draw order indices must be updated
+		int                     mVisibleDrawablesCount = 0;  // Count of drawn drawables in last Draw()
+		int                     mCulledDrawablesCount = 0;   // Count of culled drawables in last Draw()
+
 	protected:
 		// Registers actor in list
 		void RegisterActor(Actor* actor);
@@ -78,6 +111,30 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// Inserts drawable into enabled drawables by depth
+		void InsertEnabledDrawable(ISceneDrawable* drawable);
+
+		// It is called when drawable bounds were changed, its culling proxy will be updated before drawing
+		void OnDrawableBoundsChanged(ISceneDrawable* drawable);
+
+		// Adds enabled drawable to culling tree or to not cullable drawables
+		void AddCullingDrawable(ISceneDrawable* drawable);
+
+		// Removes drawable from culling tree or from not cullable drawables
+		void RemoveCullingDrawable(ISceneDrawable* drawable);
+
+		// Rebuilds culling tree from enabled drawables, clears it when culling is disabled
+		void RebuildCulling();
+
+		// Updates culling proxies of drawables with changed bounds
+		void UpdateCullingBounds();
+
+		// Collects drawables intersecting rectangle and not cullable drawables into visible drawables, sorted by draw order
+		void CollectVisibleDrawables(const RectF& rect);
+
+		// Completion deserialization callback, rebuilds culling tree
+		void OnDeserialized(const DataValue& node) override;
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -112,10 +169,18 @@ CLASS_FIELDS_META(o2::SceneLayer)
 {
 	FIELD().DEFAULT_VALUE(true).NAME(visible).PUBLIC();
 	FIELD().SERIALIZABLE_ATTRIBUTE().NAME(mName).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mDrawsSorting).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mCulling).PROTECTED();
 	FIELD().NAME(mActors).PROTECTED();
 	FIELD().NAME(mEnabledActors).PROTECTED();
 	FIELD().NAME(mDrawables).PROTECTED();
 	FIELD().NAME(mEnabledDrawables).PROTECTED();
+	FIELD().NAME(mNotCullableDrawables).PROTECTED();
+	FIELD().NAME(mChangedBoundsDrawables).PROTECTED();
+	FIELD().NAME(mVisibleDrawables).PROTECTED();
+	FIELD().DEFAULT_VALUE(true).NAME(mDrawOrderChanged).PROTECTED();
+	FIELD().DEFAULT_VALUE(0).NAME(mVisibleDrawablesCount).PROTECTED();
+	FIELD().DEFAULT_VALUE(0).NAME(mCulledDrawablesCount).PROTECTED();
 }
 END_META;
 CLASS_METHODS_META(o2::SceneLayer)
@@ -127,6 +192,13 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PUBLIC_FUNCTION(const Vector<Actor*>&, GetEnabledActors);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetDrawables);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	PUBLIC_FUNCTION(void, SetDrawsSortingEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsDrawsSortingEnabled);
+	PUBLIC_FUNCTION(void, SetCullingEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsCullingEnabled);
+	PUBLIC_FUNCTION(int, GetVisibleDrawablesCount);
+	PUBLIC_FUNCTION(int, GetCulledDrawablesCount);
+	PUBLIC_FUNCTION(void, Draw);
 	PROTECTED_FUNCTION(void, RegisterActor, Actor*);
 	PROTECTED_FUNCTION(void, UnregisterActor, Actor*);
 	PROTECTED_FUNCTION(void, OnActorEnabled, Actor*);
@@ -137,5 +209,13 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PROTECTED_FUNCTION(void, OnDrawableEnabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, OnDrawableDisabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, SetLastByDepth, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, InsertEnabledDrawable, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, OnDrawableBoundsChanged, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, AddCullingDrawable, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, RemoveCullingDrawable, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, RebuildCulling);
+	PROTECTED_FUNCTION(void, UpdateCullingBounds);
+	PROTECTED_FUNCTION(void, CollectVisibleDrawables, const RectF&);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
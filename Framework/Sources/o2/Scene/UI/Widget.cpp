@@ -227,8 +227,8 @@ namespace o2
 				}
 			}
 
-			for (auto comp : mComponents)
-				comp->Update(dt);
+			if (mSceneStatus != SceneStatus::InScene)
+				UpdateComponents(dt);
 		}
 	}
 
@@ -293,13 +293,22 @@ namespace o2
 		{
 			if (mIsClipped)
 			{
+				if (mDrawsSorting)
+					o2Render.BeginDrawsSorting();
+
 				for (auto child : mDrawingChildren)
 					child->Draw();
+
+				if (mDrawsSorting)
+					o2Render.EndDrawsSorting();
 			}
 
 			return;
 		}
 
+		if (mDrawsSorting)
+			o2Render.BeginDrawsSorting();
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
@@ -314,6 +323,9 @@ namespace o2
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
 
+		if (mDrawsSorting)
+			o2Render.EndDrawsSorting();
+
 		DrawDebugFrame();
 	}
 
@@ -862,6 +874,16 @@ namespace o2
 		return mOverrideDepth;
 	}
 
+	void Widget::SetDrawsSortingEnabled(bool enabled)
+	{
+		mDrawsSorting = enabled;
+	}
+
+	bool Widget::IsDrawsSortingEnabled() const
+	{
+		return mDrawsSorting;
+	}
+
 	void Widget::SetTransparency(float transparency)
 	{
 		mTransparency = transparency;
@@ -188,6 +188,13 @@ namespace o2
 		// Is sorting depth overridden
 		bool IsDepthOverriden() const;
 
+		// Sets draws sorting enabled. When enabled, not overlapping layers and children are reordered by texture
+		// to reduce draw calls
+		void SetDrawsSortingEnabled(bool enabled);
+
+		// Returns is draws sorting enabled
+		bool IsDrawsSortingEnabled() const;
+
 		// Sets widget's transparency
 		void SetTransparency(float transparency);
 
@@ -270,6 +277,8 @@ namespace o2
 
 		bool mOverrideDepth = false; // Is sorting order depth overridden. If not, sorting order depends on hierarchy @SERIALIZABLE
 
+		bool mDrawsSorting = false; // Is layers and children drawing reordering by texture enabled @SERIALIZABLE
+
 		float mTransparency = 1.0f;	   // Widget transparency @SERIALIZABLE
 		float mResTransparency = 1.0f; // Widget result transparency, depends on parent's result transparency
 
@@ -740,6 +749,7 @@ CLASS_FIELDS_META(o2::Widget)
 	FIELD().DONT_DELETE_ATTRIBUTE().NAME(mInternalWidgets).PROTECTED();
 	FIELD().DONT_DELETE_ATTRIBUTE().NAME(mDrawingChildren).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mOverrideDepth).PROTECTED();
+	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mDrawsSorting).PROTECTED();
 	FIELD().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1.0f).NAME(mTransparency).PROTECTED();
 	FIELD().DEFAULT_VALUE(1.0f).NAME(mResTransparency).PROTECTED();
 	FIELD().NAME(mDrawingLayers).PROTECTED();
@@ -798,6 +808,8 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(const Vector<WidgetState*>&, GetStates);
 	PUBLIC_FUNCTION(void, SetDepthOverridden, bool);
 	PUBLIC_FUNCTION(bool, IsDepthOverriden);
+	PUBLIC_FUNCTION(void, SetDrawsSortingEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsDrawsSortingEnabled);
 	PUBLIC_FUNCTION(void, SetTransparency, float);
 	PUBLIC_FUNCTION(float, GetTransparency);
 	PUBLIC_FUNCTION(float, GetResTransparency);
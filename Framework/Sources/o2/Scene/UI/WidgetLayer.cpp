@@ -460,6 +460,11 @@ namespace o2
 		return mAbsolutePosition;
 	}
 
+	const RectF& WidgetLayer::GetInteractableArea() const
+	{
+		return mInteractableArea;
+	}
+
 	void WidgetLayer::SetOwnerWidget(Widget* owner)
 	{
 		mOwnerWidget = owner;
@@ -135,6 +135,9 @@ namespace o2
 		// Returns layout rectangle
 		const RectF& GetRect() const;
 
+		// Returns interactable area rectangle, used in IsUnderPoint
+		const RectF& GetInteractableArea() const;
+
 		SERIALIZABLE(WidgetLayer);
 
 	protected:
@@ -413,6 +416,7 @@ CLASS_METHODS_META(o2::WidgetLayer)
 	PUBLIC_FUNCTION(float, GetResTransparency);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
 	PUBLIC_FUNCTION(const RectF&, GetRect);
+	PUBLIC_FUNCTION(const RectF&, GetInteractableArea);
 	PROTECTED_FUNCTION(void, SerializeRaw, DataValue&);
 	PROTECTED_FUNCTION(void, DeserializeRaw, const DataValue&);
 	PROTECTED_FUNCTION(void, SerializeWithProto, DataValue&);
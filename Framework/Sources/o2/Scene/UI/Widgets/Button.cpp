@@ -84,6 +84,14 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && isPointInside(point);
 	}
 
+	RectF Button::GetCursorAreaBounds()
+	{
+		if (isPointInside.IsEmpty())
+			return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+
+		return mDrawingScissorRect;
+	}
+
 	String Button::GetCreateMenuGroup()
 	{
 		return "Basic";
@@ -292,6 +292,11 @@ namespace o2
 		mAbsoluteClip = mClipLayout.Calculate(GetLayoutData().worldRectangle);
 	}
 
+	RectF CustomDropDown::GetCursorAreaBounds()
+	{
+		return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+	}
+
 	String CustomDropDown::GetCreateMenuGroup()
 	{
 		return "Dropping";
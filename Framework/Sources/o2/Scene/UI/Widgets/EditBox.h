@@ -147,6 +147,9 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns rectangle, containing all points where cursor can be under this
+		RectF GetCursorAreaBounds() override;
+
 		// Returns true when input events can be handled by down listeners, always returns false
 		bool IsInputTransparent() const override;
 
@@ -362,6 +365,7 @@ CLASS_METHODS_META(o2::EditBox)
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(bool, IsInputTransparent);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, UpdateTransparency);
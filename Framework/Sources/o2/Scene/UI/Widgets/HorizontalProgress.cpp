@@ -161,6 +161,14 @@ namespace o2
 		return true;
 	}
 
+	RectF HorizontalProgress::GetCursorAreaBounds()
+	{
+		if (mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mBackLayer->GetInteractableArea());
+
+		return RectF();
+	}
+
 	void HorizontalProgress::OnCursorPressed(const Input::Cursor& cursor)
 	{
 		auto pressedState = state["pressed"];
@@ -176,6 +176,20 @@ namespace o2
 		return !Math::Equals(mMinValue, mMaxValue);
 	}
 
+	RectF HorizontalScrollBar::GetCursorAreaBounds()
+	{
+		if (mHandleLayer && mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mHandleLayer->GetInteractableArea().Expand(mBackLayer->GetInteractableArea()));
+
+		if (mHandleLayer)
+			return mDrawingScissorRect.GetIntersection(mHandleLayer->GetInteractableArea());
+
+		if (mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mBackLayer->GetInteractableArea());
+
+		return RectF();
+	}
+
 	void HorizontalScrollBar::OnCursorPressed(const Input::Cursor& cursor)
 	{
 
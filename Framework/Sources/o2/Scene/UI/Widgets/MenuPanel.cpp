@@ -330,6 +330,11 @@ namespace o2
 		return mSelectionLayout;
 	}
 
+	RectF MenuPanel::GetCursorAreaBounds()
+	{
+		return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+	}
+
 	Widget* MenuPanel::CreateItem(const Item& item)
 	{
 		Widget* newItem = mItemSample->CloneAs<Widget>();
@@ -110,6 +110,9 @@ namespace o2
 		// Returns selection drawable layout
 		Layout GetSelectionDrawableLayout() const;
 
+		// Returns widget bounds, clipped by drawing scissor rect
+		RectF GetCursorAreaBounds() override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -216,6 +219,7 @@ CLASS_METHODS_META(o2::MenuPanel)
 	PUBLIC_FUNCTION(Sprite*, GetSelectionDrawable);
 	PUBLIC_FUNCTION(void, SetSelectionDrawableLayout, const Layout&);
 	PUBLIC_FUNCTION(Layout, GetSelectionDrawableLayout);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, OnEnableInHierarchyChanged);
 	PROTECTED_FUNCTION(ContextMenu*, CreateSubContext, WString&);
@@ -488,6 +488,11 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	RectF ScrollArea::GetCursorAreaBounds()
+	{
+		return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+	}
+
 	bool ScrollArea::IsScrollable() const
 	{
 		return true;
@@ -147,6 +147,11 @@ namespace o2
 		return true;
 	}
 
+	RectF Toggle::GetCursorAreaBounds()
+	{
+		return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+	}
+
 	void Toggle::SetToggleGroup(ToggleGroup* toggleGroup)
 	{
 		if (mToggleGroup == toggleGroup)
@@ -94,6 +94,11 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	RectF TreeNode::GetCursorAreaBounds()
+	{
+		return mDrawingScissorRect.GetIntersection(layout->GetWorldBasis().AABB());
+	}
+
 	void TreeNode::SetSelectedState(bool state)
 	{
 		if (!mSelectedState)
@@ -529,6 +529,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns rectangle, containing all points where cursor can be under this
+		RectF GetCursorAreaBounds() override;
+
 		// Sets selected state
 		void SetSelectedState(bool state);
 
@@ -790,6 +793,7 @@ CLASS_METHODS_META(o2::TreeNode)
 	PUBLIC_FUNCTION(void, Collapse, bool);
 	PUBLIC_FUNCTION(void*, GetObject);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(void, SetSelectedState, bool);
 	PUBLIC_FUNCTION(void, SetFocusedState, bool);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
@@ -160,6 +160,14 @@ namespace o2
 		return true;
 	}
 
+	RectF VerticalProgress::GetCursorAreaBounds()
+	{
+		if (mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mBackLayer->GetInteractableArea());
+
+		return RectF();
+	}
+
 	void VerticalProgress::OnCursorPressed(const Input::Cursor& cursor)
 	{
 		auto pressedState = state["pressed"];
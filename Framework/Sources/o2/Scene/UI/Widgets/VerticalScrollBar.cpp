@@ -170,6 +170,20 @@ namespace o2
 		return !Math::Equals(mMinValue, mMaxValue);
 	}
 
+	RectF VerticalScrollBar::GetCursorAreaBounds()
+	{
+		if (mHandleLayer && mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mHandleLayer->GetInteractableArea().Expand(mBackLayer->GetInteractableArea()));
+
+		if (mHandleLayer)
+			return mDrawingScissorRect.GetIntersection(mHandleLayer->GetInteractableArea());
+
+		if (mBackLayer)
+			return mDrawingScissorRect.GetIntersection(mBackLayer->GetInteractableArea());
+
+		return RectF();
+	}
+
 	void VerticalScrollBar::OnCursorPressed(const Input::Cursor& cursor)
 	{
 		if (mHandleLayer && mHandleLayer->IsUnderPoint(cursor.position))
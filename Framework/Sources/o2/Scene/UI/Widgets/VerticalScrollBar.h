@@ -89,6 +89,9 @@ namespace o2
 		// Returns is listener scrollable
 		bool IsScrollable() const override;
 
+		// Returns interactable areas of layers, clipped by drawing scissor rect
+		RectF GetCursorAreaBounds() override;
+
 		// Updates layout
 		void UpdateSelfTransform() override;
 
@@ -215,6 +218,7 @@ CLASS_METHODS_META(o2::VerticalScrollBar)
 	PUBLIC_FUNCTION(void, SetMinimalScrollHandleSize, float);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
 	PUBLIC_FUNCTION(bool, IsScrollable);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, UpdateLayersLayouts);
@@ -1,6 +1,6 @@
 #include "stdafx.h"
 
-#if defined PLATFORM_ANDROID || true
+#ifdef PLATFORM_ANDROID
 
 #include "Utils/FileSystem/File.h"
 
@@ -70,6 +70,11 @@ namespace o2
         return length;
     }
 
+    char* InFile::MapFullData()
+    {
+        return nullptr;
+    }
+
     String InFile::ReadFullData()
     {
         UInt len = GetDataSize();
@@ -138,7 +143,10 @@ namespace o2
     bool OutFile::Close()
     {
         if (mOpened)
+        {
             mOfstream.close();
+            mOpened = false;
+        }
 
         return true;
     }
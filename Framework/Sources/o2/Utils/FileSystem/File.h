@@ -37,6 +37,10 @@ namespace o2
 		// Read full file data and return size of ridden data
 		UInt ReadFullData(void *dataPtr);
 
+		// Maps full file data into memory. Data is writable with copy on write and followed by zero, so it can be parsed in 
+		// place. Mapping lives until file is closed. Returns nullptr when mapping isn't supported or available
+		char* MapFullData();
+
 		// Read data in dataPtr
 		void ReadData(void *dataPtr, UInt bytes);
 
@@ -63,6 +67,12 @@ namespace o2
 #ifdef PLATFORM_ANDROID
 		AAsset* mAsset = nullptr;
 #endif
+
+#ifdef PLATFORM_LINUX
+		int   mFile = -1;            // File descriptor
+		char* mMappedData = nullptr; // Mapped file data, nullptr when not mapped
+		UInt  mMappedSize = 0;       // Mapped file data size
+#endif
 	};
 
 	// -----------
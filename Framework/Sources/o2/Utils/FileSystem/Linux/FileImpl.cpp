@@ -0,0 +1,171 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Reflection/Reflection.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace o2
+{
+	bool InFile::Open(const String& filename)
+	{
+		Close();
+
+		mFile = open(filename.Data(), O_RDONLY | O_CLOEXEC);
+		if (mFile < 0)
+			return false;
+
+		mOpened = true;
+		mFilename = filename;
+
+		return true;
+	}
+
+	bool InFile::Close()
+	{
+		if (mOpened)
+		{
+			if (mMappedData)
+				munmap(mMappedData, mMappedSize);
+
+			close(mFile);
+
+			mMappedData = nullptr;
+			mMappedSize = 0;
+			mFile = -1;
+			mOpened = false;
+		}
+
+		return true;
+	}
+
+	char* InFile::MapFullData()
+	{
+		if (mMappedData)
+			return mMappedData;
+
+		if (!mOpened)
+			return nullptr;
+
+		// Mapping is followed by zeros only when file size isn't multiple of page size. Otherwise reading 
+		// after mapping end crashes, so data must be read in usual way
+		UInt size = GetDataSize();
+		if (size == 0 || size % (UInt)sysconf(_SC_PAGESIZE) == 0)
+			return nullptr;
+
+		void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, mFile, 0);
+		if (mapping == MAP_FAILED)
+			return nullptr;
+
+		madvise(mapping, size, MADV_SEQUENTIAL);
+
+		mMappedData = (char*)mapping;
+		mMappedSize = size;
+
+		return mMappedData;
+	}
+
+	UInt InFile::ReadFullData(void *dataPtr)
+	{
+		UInt length = GetDataSize();
+
+		if (char* mapping = MapFullData())
+			memcpy(dataPtr, mapping, length);
+		else
+		{
+			SetCaretPos(0);
+			ReadData(dataPtr, length);
+		}
+
+		return length;
+	}
+
+	String InFile::ReadFullData()
+	{
+		if (char* mapping = MapFullData())
+			return String(mapping);
+
+		UInt len = GetDataSize();
+		char* buffer = mnew char[len + 1];
+
+		SetCaretPos(0);
+		ReadData(buffer, len);
+		buffer[len] = '\0';
+
+		String res(buffer);
+		delete[] buffer;
+
+		return res;
+	}
+
+	void InFile::ReadData(void *dataPtr, UInt bytes)
+	{
+		char* dst = (char*)dataPtr;
+		while (bytes > 0)
+		{
+			ssize_t res = read(mFile, dst, bytes);
+			if (res <= 0)
+				break;
+
+			dst += res;
+			bytes -= (UInt)res;
+		}
+	}
+
+	void InFile::SetCaretPos(UInt pos)
+	{
+		lseek(mFile, pos, SEEK_SET);
+	}
+
+	UInt InFile::GetCaretPos()
+	{
+		return (UInt)lseek(mFile, 0, SEEK_CUR);
+	}
+
+	UInt InFile::GetDataSize()
+	{
+		struct stat fileStat;
+		if (fstat(mFile, &fileStat) != 0)
+			return 0;
+
+		return (UInt)fileStat.st_size;
+	}
+
+	bool OutFile::Open(const String& filename)
+	{
+		Close();
+
+		mOfstream.open(filename, std::ios::binary);
+
+		if (!mOfstream.is_open())
+			return false;
+
+		mOpened = true;
+		mFilename = filename;
+
+		return true;
+	}
+
+	bool OutFile::Close()
+	{
+		if (mOpened)
+		{
+			mOfstream.close();
+			mOpened = false;
+		}
+
+		return true;
+	}
+
+	void OutFile::WriteData(const void* dataPtr, UInt bytes)
+	{
+		mOfstream.write((const char*)dataPtr, bytes);
+	}
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,285 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace o2
+{
+	// Converts system time into local time stamp
+	static TimeStamp ToTimeStamp(Int64 seconds)
+	{
+		time_t time = (time_t)seconds;
+		tm local;
+		localtime_r(&time, &local);
+
+		return TimeStamp(local.tm_sec, local.tm_min, local.tm_hour, local.tm_mday, local.tm_mon + 1, local.tm_year + 1900);
+	}
+
+	// Copies file data with kernel copying when it is available
+	static bool CopyFileData(int source, int dest)
+	{
+		while (true)
+		{
+			ssize_t res = copy_file_range(source, nullptr, dest, nullptr, 1 << 30, 0);
+			if (res == 0)
+				return true;
+
+			if (res < 0)
+				break;
+		}
+
+		if (errno != EXDEV && errno != ENOSYS && errno != EINVAL && errno != EOPNOTSUPP)
+			return false;
+
+		char buffer[64*1024];
+		while (true)
+		{
+			ssize_t readSize = read(source, buffer, sizeof(buffer));
+			if (readSize == 0)
+				return true;
+
+			if (readSize < 0)
+				return false;
+
+			for (ssize_t written = 0; written < readSize;)
+			{
+				ssize_t res = write(dest, buffer + written, readSize - written);
+				if (res < 0)
+					return false;
+
+				written += res;
+			}
+		}
+	}
+
+	FolderInfo FileSystem::GetFolderInfo(const String& path) const
+	{
+		FolderInfo res;
+		res.path = path;
+
+		DIR* dir = opendir(path.Data());
+		if (!dir)
+		{
+			mInstance->mLog->Error("Failed GetPathInfo: Error opening directory " + path);
+			return res;
+		}
+
+		while (dirent* entry = readdir(dir))
+		{
+			if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String entryPath = path + "/" + entry->d_name;
+
+			bool isDirectory = entry->d_type == DT_DIR;
+			if (entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK)
+			{
+				struct stat entryStat;
+				isDirectory = stat(entryPath.Data(), &entryStat) == 0 && S_ISDIR(entryStat.st_mode);
+			}
+
+			if (isDirectory)
+				res.folders.Add(GetFolderInfo(entryPath));
+			else
+				res.files.Add(GetFileInfo(entryPath));
+		}
+
+		closedir(dir);
+
+		return res;
+	}
+
+	bool FileSystem::FileCopy(const String& source, const String& dest) const
+	{
+		FileDelete(dest);
+		FolderCreate(ExtractPathStr(dest));
+
+		int sourceFile = open(source.Data(), O_RDONLY | O_CLOEXEC);
+		if (sourceFile < 0)
+			return false;
+
+		struct stat sourceStat;
+		fstat(sourceFile, &sourceStat);
+
+		int destFile = open(dest.Data(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, sourceStat.st_mode & 0777);
+		if (destFile < 0)
+		{
+			close(sourceFile);
+			return false;
+		}
+
+		bool res = CopyFileData(sourceFile, destFile);
+
+		close(sourceFile);
+		close(destFile);
+
+		return res;
+	}
+
+	bool FileSystem::FileDelete(const String& file) const
+	{
+		return unlink(file.Data()) == 0;
+	}
+
+	bool FileSystem::FileMove(const String& source, const String& dest) const
+	{
+		String destFolder = GetParentPath(dest);
+
+		if (!IsFolderExist(destFolder))
+			FolderCreate(destFolder);
+
+		if (rename(source.Data(), dest.Data()) == 0)
+			return true;
+
+		if (errno != EXDEV || !FileCopy(source, dest))
+			return false;
+
+		return FileDelete(source);
+	}
+
+	FileInfo FileSystem::GetFileInfo(const String& path) const
+	{
+		FileInfo res;
+		res.path = "invalid_file";
+
+		struct statx fileStat;
+		if (statx(AT_FDCWD, path.Data(), 0, STATX_BASIC_STATS | STATX_BTIME, &fileStat) != 0)
+			return res;
+
+		// Creation time isn't supported by all file systems, using last status change instead
+		Int64 creationTime = (fileStat.stx_mask & STATX_BTIME) ? fileStat.stx_btime.tv_sec : fileStat.stx_ctime.tv_sec;
+
+		res.createdDate = ToTimeStamp(creationTime);
+		res.accessDate = ToTimeStamp(fileStat.stx_atime.tv_sec);
+		res.editDate = ToTimeStamp(fileStat.stx_mtime.tv_sec);
+
+		res.path = path;
+		res.size = (Int64)fileStat.stx_size;
+
+		return res;
+	}
+
+	bool FileSystem::SetFileEditDate(const String& path, const TimeStamp& time) const
+	{
+		tm local = {};
+		local.tm_sec = time.mSecond;
+		local.tm_min = time.mMinute;
+		local.tm_hour = time.mHour;
+		local.tm_mday = time.mDay;
+		local.tm_mon = time.mMonth - 1;
+		local.tm_year = time.mYear - 1900;
+		local.tm_isdst = -1;
+
+		timespec times[2];
+		times[0].tv_sec = 0;
+		times[0].tv_nsec = UTIME_OMIT;
+		times[1].tv_sec = mktime(&local);
+		times[1].tv_nsec = 0;
+
+		return utimensat(AT_FDCWD, path.Data(), times, 0) == 0;
+	}
+
+	bool FileSystem::FolderCreate(const String& path, bool recursive /*= true*/) const
+	{
+		if (IsFolderExist(path))
+			return true;
+
+		if (!recursive)
+			return mkdir(path.Data(), 0755) == 0;
+
+		if (mkdir(path.Data(), 0755) == 0)
+			return true;
+
+		String extrPath = ExtractPathStr(path);
+		if (extrPath == path)
+			return false;
+
+		if (!FolderCreate(extrPath, true))
+			return false;
+
+		return mkdir(path.Data(), 0755) == 0 || errno == EEXIST;
+	}
+
+	bool FileSystem::FolderCopy(const String& from, const String& to) const
+	{
+		if (!IsFolderExist(from) || !IsFolderExist(to))
+			return false;
+
+		std::error_code error;
+		std::filesystem::path destination = std::filesystem::path(to.Data())/std::filesystem::path(from.Data()).filename();
+		std::filesystem::copy(from.Data(), destination, std::filesystem::copy_options::recursive, error);
+		return !error;
+	}
+
+	bool FileSystem::FolderRemove(const String& path, bool recursive /*= true*/) const
+	{
+		if (!IsFolderExist(path))
+			return false;
+
+		if (!recursive)
+			return rmdir(path.Data()) == 0;
+
+		DIR* dir = opendir(path.Data());
+		if (dir)
+		{
+			while (dirent* entry = readdir(dir))
+			{
+				if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+					continue;
+
+				String entryPath = path + "/" + entry->d_name;
+
+				struct stat entryStat;
+				if (lstat(entryPath.Data(), &entryStat) == 0 && S_ISDIR(entryStat.st_mode))
+					FolderRemove(entryPath, true);
+				else
+					FileDelete(entryPath);
+			}
+
+			closedir(dir);
+		}
+
+		return rmdir(path.Data()) == 0;
+	}
+
+	bool FileSystem::Rename(const String& old, const String& newPath) const
+	{
+		int res = rename(old, newPath);
+		return res == 0;
+	}
+
+	bool FileSystem::IsFolderExist(const String& path) const
+	{
+		struct stat pathStat;
+		return stat(path.Data(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+	}
+
+	bool FileSystem::IsFileExist(const String& path) const
+	{
+		struct stat pathStat;
+		return stat(path.Data(), &pathStat) == 0 && !S_ISDIR(pathStat.st_mode);
+	}
+
+	String FileSystem::GetPathRelativeToPath(const String& from, const String& to)
+	{
+		return std::filesystem::path(to.Data()).lexically_relative(from.Data()).string();
+	}
+
+	String FileSystem::CanonicalizePath(const String& path)
+	{
+		return std::filesystem::path(path.Data()).lexically_normal().string();
+	}
+}
+
+#endif // PLATFORM_LINUX
@@ -42,6 +42,11 @@ namespace o2
         return length;
     }
 
+    char* InFile::MapFullData()
+    {
+        return nullptr;
+    }
+
     String InFile::ReadFullData()
     {
         UInt len = GetDataSize();
@@ -96,7 +101,10 @@ namespace o2
     bool OutFile::Close()
     {
         if (mOpened)
+        {
             mOfstream.close();
+            mOpened = false;
+        }
 
         return true;
     }
@@ -7,7 +7,7 @@ namespace o2
 {
 	void Geometry::CreatePolyLineMesh(const Vertex2* points, int pointsCount,
 									  Vertex2*& verticies, UInt& vertexCount, UInt& vertexSize,
-									  UInt16*& indexes, UInt& polyCount, UInt& polySize,
+									  VertexIndex*& indexes, UInt& polyCount, UInt& polySize,
 									  float width, float texBorderTop, float texBorderBottom, const Vec2F& texSize,
 									  const Vec2F& invCameraScale /*= Vec2F(1, 1)*/)
 	{
@@ -28,7 +28,7 @@ namespace o2
 			if (indexes)
 				delete[] indexes;
 
-			indexes = new UInt16[newPolyCount*3];
+			indexes = new VertexIndex[newPolyCount*3];
 			polySize = newPolyCount;
 		}
 
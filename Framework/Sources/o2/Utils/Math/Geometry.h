@@ -10,7 +10,7 @@ namespace o2
 	{
 		void CreatePolyLineMesh(const Vertex2* points, int pointsCount, 
 								Vertex2*& verticies, UInt& vertexCount, UInt& vertexSize,
-								UInt16*& indexes, UInt& polyCount, UInt& polySize,
+								VertexIndex*& indexes, UInt& polyCount, UInt& polySize,
 								float width, float texBorderTop, float texBorderBottom, const Vec2F& texSize,
 								const Vec2F& invCameraScale = Vec2F(1, 1));
 	}
@@ -1,10 +1,18 @@
 #pragma once
 
+#include "o2/EngineSettings.h"
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Types/CommonTypes.h"
 
 namespace o2
 {
+	// Vertex index type in meshes and render batches
+#if RENDER_32BIT_INDEXES
+	typedef UInt VertexIndex;
+#else
+	typedef UInt16 VertexIndex;
+#endif
+
 	class Vertex2
 	{
 	public:
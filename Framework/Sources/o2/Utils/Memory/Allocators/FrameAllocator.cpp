@@ -0,0 +1,131 @@
+#include "o2/stdafx.h"
+#include "FrameAllocator.h"
+
+namespace o2
+{
+	FrameAllocator::FrameAllocator(size_t chunkSize /*= 256*1024*/,
+								   IAllocator* baseAllocator /*= DefaultAllocator::GetInstance()*/)
+	{
+		mBaseAllocator = baseAllocator;
+		mChunkSize = chunkSize;
+		mOwnerThreadId = std::this_thread::get_id();
+
+		AddChunk(mChunkSize);
+	}
+
+	FrameAllocator::~FrameAllocator()
+	{
+		ReleaseChunks();
+	}
+
+	void* FrameAllocator::Allocate(size_t size)
+	{
+		CheckOwnerThread();
+
+		size_t alignedSize = (size + mAlignment - 1) & ~(mAlignment - 1);
+
+		if (!mHead || mHead->used + alignedSize > mHead->capacity)
+			AddChunk(Math::Max(alignedSize, mChunkSize));
+
+		void* res = mHead->data + mHead->used;
+		mHead->used += alignedSize;
+
+		mLastAllocation = res;
+		mAllocationsCount++;
+		mAllocatedBytes += size;
+
+		return res;
+	}
+
+	void FrameAllocator::Deallocate(void* ptr)
+	{}
+
+	void* FrameAllocator::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+	{
+		CheckOwnerThread();
+
+		if (ptr && ptr == mLastAllocation)
+		{
+			size_t offset = (std::byte*)ptr - mHead->data;
+			size_t alignedSize = (newSize + mAlignment - 1) & ~(mAlignment - 1);
+
+			if (offset + alignedSize <= mHead->capacity)
+			{
+				mHead->used = offset + alignedSize;
+				mAllocatedBytes += newSize > oldSize ? newSize - oldSize : 0;
+				return ptr;
+			}
+		}
+
+		void* newMemory = Allocate(newSize);
+		if (ptr)
+			memcpy(newMemory, ptr, Math::Min(oldSize, newSize));
+
+		return newMemory;
+	}
+
+	void FrameAllocator::Reset()
+	{
+		CheckOwnerThread();
+
+		if (mHead && mHead->prev)
+		{
+			size_t capacity = mCapacity;
+			ReleaseChunks();
+			AddChunk(capacity);
+		}
+		else if (mHead)
+			mHead->used = 0;
+
+		mLastAllocation = nullptr;
+		mAllocationsCount = 0;
+		mAllocatedBytes = 0;
+	}
+
+	int FrameAllocator::GetAllocationsCount() const
+	{
+		return mAllocationsCount;
+	}
+
+	size_t FrameAllocator::GetAllocatedBytes() const
+	{
+		return mAllocatedBytes;
+	}
+
+	size_t FrameAllocator::GetCapacity() const
+	{
+		return mCapacity;
+	}
+
+	void FrameAllocator::AddChunk(size_t capacity)
+	{
+		size_t headerSize = (sizeof(Chunk) + mAlignment - 1) & ~(mAlignment - 1);
+		void* mem = mBaseAllocator->Allocate(capacity + headerSize);
+
+		Chunk* chunk = new (mem) Chunk();
+		chunk->data = reinterpret_cast<std::byte*>(mem) + headerSize;
+		chunk->used = 0;
+		chunk->capacity = capacity;
+		chunk->prev = mHead;
+
+		mHead = chunk;
+		mCapacity += capacity;
+	}
+
+	void FrameAllocator::ReleaseChunks()
+	{
+		while (mHead)
+		{
+			Chunk* chunk = mHead;
+			mHead = chunk->prev;
+			mBaseAllocator->Deallocate(chunk);
+		}
+
+		mCapacity = 0;
+	}
+
+	void FrameAllocator::CheckOwnerThread() const
+	{
+		Assert(std::this_thread::get_id() == mOwnerThreadId, "Frame allocator is used not from main thread");
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/IAllocator.h"
+#include "o2/Utils/Memory/Allocators/DefaultAllocator.h"
+#include <thread>
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------
+	// Linear arena for transient allocations, which live no longer than one frame. Memory is taken
+	// from chunks, that are never moved, so allocations stay valid until Reset(). Deallocation is
+	// no-op. After frame with several chunks they are merged into one on reset. Not thread safe:
+	// must be used only from thread, that created it
+	// -------------------------------------------------------------------------------------------
+	class FrameAllocator: public IAllocator
+	{
+	public:
+		// Constructor. Chunk size is initial arena capacity
+		FrameAllocator(size_t chunkSize = 256*1024, IAllocator* baseAllocator = DefaultAllocator::GetInstance());
+
+		// Destructor, releases all chunks
+		~FrameAllocator() override;
+
+		// Allocates memory from arena
+		void* Allocate(size_t size) override;
+
+		// Does nothing, memory is released on reset
+		void Deallocate(void* ptr) override;
+
+		// Reallocates memory. Last allocation grows in place when it fits in chunk
+		void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override;
+
+		// Resets arena: all allocated memory becomes invalid, counters are cleared
+		void Reset();
+
+		// Returns count of allocations since last reset
+		int GetAllocationsCount() const;
+
+		// Returns allocated bytes since last reset
+		size_t GetAllocatedBytes() const;
+
+		// Returns total capacity of arena chunks
+		size_t GetCapacity() const;
+
+	private:
+		struct Chunk
+		{
+			std::byte* data;     // Chunk memory, placed right after chunk header
+			size_t     used;     // Used bytes
+			size_t     capacity; // Chunk capacity in bytes
+
+			Chunk* prev; // Previous chunk
+		};
+
+		static const size_t mAlignment = alignof(std::max_align_t); // Allocations alignment
+
+	private:
+		IAllocator* mBaseAllocator; // Allocator for chunks
+
+		size_t mChunkSize;         // Minimal size of new chunk
+		Chunk* mHead = nullptr;    // Current chunk
+		size_t mCapacity = 0;      // Total capacity of all chunks
+		void*  mLastAllocation = nullptr; // Last allocated memory, can grow in place
+
+		int    mAllocationsCount = 0; // Count of allocations since last reset
+		size_t mAllocatedBytes = 0;   // Allocated bytes since last reset
+
+		std::thread::id mOwnerThreadId; // Thread, that created allocator. Only this thread can use it
+
+	private:
+		// Adds new chunk with specified capacity
+		void AddChunk(size_t capacity);
+
+		// Releases all chunks
+		void ReleaseChunks();
+
+		// Checks that allocator is used from owner thread
+		void CheckOwnerThread() const;
+	};
+};
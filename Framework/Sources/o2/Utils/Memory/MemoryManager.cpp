@@ -2,6 +2,7 @@
 #include "MemoryManager.h"
 
 #include <algorithm>
+#include <new>
 
 #include "o2/Utils/Debug/Assert.h"
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
@@ -9,33 +10,36 @@
 
 void* operator new(size_t size, const char* location, int line)
 {
-	void* memory = ::operator new(size);
-
 #if ENALBE_MEMORY_MANAGE == true
-o2::MemoryManager::Instance().OnMemoryAllocate(memory, size, location, line);
+	return o2::MemoryManager::Allocate(size, location, line);
+#else
+	return ::operator new(size);
 #endif
-
-	return memory;
 }
 
 void* operator new[](size_t size, const char* location, int line)
 {
-	void* memory = ::operator new(size);
-
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::Instance().OnMemoryAllocate(memory, size, location, line);
+	return o2::MemoryManager::Allocate(size, location, line);
+#else
+	return ::operator new(size);
 #endif
+}
 
-	return memory;
+#if ENALBE_MEMORY_MANAGE == true
+void* operator new(size_t size)
+{
+	return o2::MemoryManager::Allocate(size, nullptr, 0);
 }
+#endif
 
 void operator delete(void* allocMemory) noexcept
 {
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::Instance().OnMemoryRelease(allocMemory);
-#endif
-
+	o2::MemoryManager::Release(allocMemory);
+#else
 	free(allocMemory);
+#endif
 }
 
 void operator delete(void* allocMemory, const char* location, int line)
@@ -55,28 +59,27 @@ void operator delete[](void* allocMemory) noexcept
 
 void* _mmalloc(size_t size, const char* location, int line)
 {
-	void* memory = ::operator new(size);
-
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::Instance().OnMemoryAllocate(memory, size, location, line);
+	return o2::MemoryManager::Allocate(size, location, line);
+#else
+	return ::operator new(size);
 #endif
-
-	return memory;
 }
 
 void _mfree(void* allocMemory)
 {
-#if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::Instance().OnMemoryRelease(allocMemory);
-#endif
-
-	free(allocMemory);
+	::operator delete(allocMemory);
 }
 
 namespace o2
 {
-	MemoryManager::MemoryManager():
-		mTotalBytes(0)
+	MemoryManager::SourceStats                  MemoryManager::mSources[MemoryManager::mSourcesTableSize];
+	std::mutex                                  MemoryManager::mSourcesMutex;
+	std::atomic<MemoryManager::ThreadCounters*> MemoryManager::mThreadsCounters(nullptr);
+
+	thread_local MemoryManager::ThreadCounters* MemoryManager::mCurrentThreadCounters = nullptr;
+
+	MemoryManager::MemoryManager()
 	{}
 
 	MemoryManager::~MemoryManager()
@@ -97,39 +100,165 @@ namespace o2
 		mInstance = new MemoryManager();
 	}
 
-	void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
+	Int64 MemoryManager::GetAllocatedBytes() const
+	{
+		Int64 res = 0;
+		for (auto counters = mThreadsCounters.load(std::memory_order_acquire); counters; counters = counters->next)
+			res += counters->allocatedBytes.load(std::memory_order_relaxed);
+
+		return res;
+	}
+
+	Int64 MemoryManager::GetAllocationsCount() const
+	{
+		Int64 res = 0;
+		for (auto counters = mThreadsCounters.load(std::memory_order_acquire); counters; counters = counters->next)
+			res += counters->allocationsCount.load(std::memory_order_relaxed);
+
+		return res;
+	}
+
+	Int64 MemoryManager::GetReleasesCount() const
+	{
+		Int64 res = 0;
+		for (auto counters = mThreadsCounters.load(std::memory_order_acquire); counters; counters = counters->next)
+			res += counters->releasesCount.load(std::memory_order_relaxed);
+
+		return res;
+	}
+
+	void* MemoryManager::Allocate(size_t size, const char* source, int line)
+	{
+		void* block = malloc(size + mHeaderSize);
+		if (!block)
+			throw std::bad_alloc();
+
+		AllocHeader* header = (AllocHeader*)block;
+		header->size = size;
+		header->source = source ? GetSourceStats(source, line) : nullptr;
+
+		if (header->source)
+		{
+			header->source->allocationsCount.fetch_add(1, std::memory_order_relaxed);
+			header->source->allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+			header->source->totalCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		ThreadCounters& counters = GetThreadCounters();
+		IncreaseThreadCounter(counters.allocationsCount, 1);
+		IncreaseThreadCounter(counters.allocatedBytes, size);
+
+		return (char*)block + mHeaderSize;
+	}
+
+	void MemoryManager::Release(void* memory)
 	{
-		AllocInfo info;
-		info.memory = memory;
-		info.size = size;
-		info.sourceLine = line;
-		info.source = source;
-		mAllocs[memory] = info;
-		mTotalBytes += size;
+		if (!memory)
+			return;
+
+		AllocHeader* header = (AllocHeader*)((char*)memory - mHeaderSize);
+
+		if (header->source)
+		{
+			header->source->allocationsCount.fetch_sub(1, std::memory_order_relaxed);
+			header->source->allocatedBytes.fetch_sub(header->size, std::memory_order_relaxed);
+		}
+
+		// Memory can be released in other thread, so its counters may go negative, only sum is meaningful
+		ThreadCounters& counters = GetThreadCounters();
+		IncreaseThreadCounter(counters.releasesCount, 1);
+		IncreaseThreadCounter(counters.allocatedBytes, -(Int64)header->size);
+
+		free(header);
 	}
 
-	void MemoryManager::OnMemoryRelease(void* memory)
+	MemoryManager::SourceStats* MemoryManager::GetSourceStats(const char* source, int line)
 	{
-		std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
-		if (fnd != mAllocs.end())
+		size_t hash = (((size_t)source >> 3) ^ ((size_t)line*2654435761u)) & (mSourcesTableSize - 1);
+
+		// Lock-free search, entries are never removed and source is published after line
+		for (UInt i = 0; i < mSourcesTableSize; i++)
+		{
+			SourceStats& stats = mSources[(hash + i) & (mSourcesTableSize - 1)];
+			const char* statsSource = stats.source.load(std::memory_order_acquire);
+
+			if (!statsSource)
+				break;
+
+			if (statsSource == source && stats.line == line)
+				return &stats;
+		}
+
+		std::lock_guard<std::mutex> lock(mSourcesMutex);
+
+		for (UInt i = 0; i < mSourcesTableSize; i++)
 		{
-			mTotalBytes -= (*fnd).second.size;
-			mAllocs.erase(fnd);
+			SourceStats& stats = mSources[(hash + i) & (mSourcesTableSize - 1)];
+			const char* statsSource = stats.source.load(std::memory_order_relaxed);
+
+			if (!statsSource)
+			{
+				stats.line = line;
+				stats.source.store(source, std::memory_order_release);
+				return &stats;
+			}
+
+			if (statsSource == source && stats.line == line)
+				return &stats;
 		}
+
+		return nullptr;
+	}
+
+	MemoryManager::ThreadCounters& MemoryManager::GetThreadCounters()
+	{
+		if (!mCurrentThreadCounters)
+		{
+			ThreadCounters* counters = new (malloc(sizeof(ThreadCounters))) ThreadCounters();
+			counters->allocationsCount.store(0, std::memory_order_relaxed);
+			counters->releasesCount.store(0, std::memory_order_relaxed);
+			counters->allocatedBytes.store(0, std::memory_order_relaxed);
+
+			counters->next = mThreadsCounters.load(std::memory_order_relaxed);
+			while (!mThreadsCounters.compare_exchange_weak(counters->next, counters, std::memory_order_release,
+														   std::memory_order_relaxed));
+
+			mCurrentThreadCounters = counters;
+		}
+
+		return *mCurrentThreadCounters;
+	}
+
+	void MemoryManager::IncreaseThreadCounter(std::atomic<Int64>& counter, Int64 value)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 	}
 
 	void MemoryManager::DumpInfo()
 	{
 		printf("========MemoryManager::DumpInfo==========\n");
 
-		printf("Total managed allocations: %f MB\n", (float)mTotalBytes / 1024.0f / 1024.0f);
+		if constexpr (!ENALBE_MEMORY_MANAGE)
+		{
+			printf("Memory managing is disabled\n");
+			printf("========END==========\n");
+			return;
+		}
+
+		int threadsCount = 0;
+		for (auto counters = mThreadsCounters.load(std::memory_order_acquire); counters; counters = counters->next)
+			threadsCount++;
+
+		printf("Total allocated: %f MB in %lli allocations, %lli releases from %i threads\n",
+			   (float)GetAllocatedBytes() / 1024.0f / 1024.0f, GetAllocationsCount(), GetReleasesCount(), threadsCount);
 
 		struct allocSrc
 		{
-			char source[128];
-			int line = 0;
-			int size = 0;
-			int count = 0;
+			const char* source = nullptr;
+			int         line = 0;
+			Int64       size = 0;
+			Int64       count = 0;
+			Int64       totalCount = 0;
 
 			bool operator<(const allocSrc& other) const
 			{
@@ -138,42 +267,41 @@ namespace o2
 		};
 		std::vector<allocSrc> allocs;
 
-		int i = 0;
-		for (auto it = mAllocs.begin(); it != mAllocs.end(); ++it, i++)
+		// Same file can have different source pointers in different translation units, merging them by name
+		for (auto& stats : mSources)
 		{
-			auto& info = (*it).second;
+			const char* source = stats.source.load(std::memory_order_acquire);
+			if (!source)
+				continue;
 
-			bool found = false;
-			for (auto& allc : allocs)
-			{
-				if (allc.line == info.sourceLine && strcmp(allc.source, info.source) == 0)
-				{
-					allc.size += info.size;
-					allc.count++;
-					found = true;
-					break;
-				}
-			}
+			Int64 count = stats.allocationsCount.load(std::memory_order_relaxed);
+			if (count == 0)
+				continue;
+
+			auto fnd = std::find_if(allocs.begin(), allocs.end(), [&](const allocSrc& x) {
+				return x.line == stats.line && strcmp(x.source, source) == 0; });
 
-			if (!found)
+			if (fnd == allocs.end())
 			{
 				allocSrc allc;
-				allc.line = info.sourceLine;
-				strncpy(allc.source, info.source, 127);
-				allc.size = info.size;
-				allc.count = 1;
-
+				allc.source = source;
+				allc.line = stats.line;
 				allocs.push_back(allc);
+				fnd = allocs.end() - 1;
 			}
+
+			fnd->size += stats.allocatedBytes.load(std::memory_order_relaxed);
+			fnd->count += count;
+			fnd->totalCount += stats.totalCount.load(std::memory_order_relaxed);
 		}
 
 		std::sort(allocs.begin(), allocs.end());
 
 		for (int i = 0; i < (int)allocs.size(); i++)
 		{
-			printf("%i: %s : %i - %i bytes (%f MB) in %i allocs\n",
+			printf("%i: %s : %i - %lli bytes (%f MB) in %lli allocs, %lli allocs total\n",
 				   i, allocs[i].source, allocs[i].line, allocs[i].size,
-				   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count);
+				   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count, allocs[i].totalCount);
 		}
 
 		printf("========END==========\n");
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <vector>
-#include <map>
 
 #include "o2/EngineSettings.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -30,6 +32,11 @@ void  operator delete(void* allocMemory, const char* location, int line);
 // Delete operator with source and line arguments
 void  operator delete[](void* allocMemory, const char* location, int line);
 
+#if ENALBE_MEMORY_MANAGE == true
+// Overloaded new operator. Allocation is header-prefixed, but not bound to source line
+void* operator new(size_t size);
+#endif
+
 // Overloaded delete operator
 void  operator delete(void* allocMemory) noexcept;
 
@@ -46,9 +53,11 @@ namespace o2
 {
 	class LogStream;
 
-	// ------------------------------------------------------------------
-	// Memory manager, using for collecting garbage, tracing memory leaks
-	// ------------------------------------------------------------------
+	// ----------------------------------------------------------------------------------------------
+	// Memory manager, using for tracing memory leaks. When ENALBE_MEMORY_MANAGE is on, every
+	// allocation is prefixed with header containing size and allocation source line statistics.
+	// Sources statistics are stored in fixed lock-free table, totals are counted per thread
+	// ----------------------------------------------------------------------------------------------
 	class MemoryManager
 	{
 	public:
@@ -64,35 +73,88 @@ namespace o2
 		// Initializes memory manager
 		static void Initialize();
 
-		// Collects information about allocated memory and prints into console
+		// Returns allocated and not released bytes count from all threads
+		Int64 GetAllocatedBytes() const;
+
+		// Returns total allocations count from all threads
+		Int64 GetAllocationsCount() const;
+
+		// Returns total releases count from all threads
+		Int64 GetReleasesCount() const;
+
+		// Collects information about allocated memory grouped by source file and line and prints into console
 		void DumpInfo();
 
 	protected:
-		// ----------------------
-		// Allocation information
-		// ----------------------
-		struct AllocInfo
+		// -------------------------------------------------------------
+		// Allocation source line statistics. Source is set only once 
+		// under lock, counters are atomic
+		// -------------------------------------------------------------
+		struct SourceStats
 		{
-			const char* source;     // Allocation source code file
-			int         sourceLine; // Allocation source code line
-			size_t      size;       // Allocated size in bytes
-			void*       memory;     // Pointer to allocated memory
+			std::atomic<const char*> source;           // Allocation source code file. Null when entry is free
+			int                      line;             // Allocation source code line
+			std::atomic<Int64>       allocationsCount; // Count of not released allocations
+			std::atomic<Int64>       allocatedBytes;   // Not released allocated bytes
+			std::atomic<Int64>       totalCount;       // Count of allocations for all time
 		};
 
+		// ------------------------------------------------------------------------
+		// Allocations counters of one thread. Written only by owner thread without 
+		// locked instructions, read by any. Kept after thread exit
+		// ------------------------------------------------------------------------
+		struct ThreadCounters
+		{
+			std::atomic<Int64> allocationsCount; // Allocations count
+			std::atomic<Int64> releasesCount;    // Releases count
+			std::atomic<Int64> allocatedBytes;   // Allocated minus released bytes
+			ThreadCounters*    next;             // Next thread counters in list
+		};
+
+		// ---------------------------------------------------------------------------------
+		// Allocation header, placed before each allocated memory block. Padded to keeping 
+		// alignment of allocated memory
+		// ---------------------------------------------------------------------------------
+		struct AllocHeader
+		{
+			SourceStats* source; // Allocation source statistics. Null when allocation isn't bound to source
+			size_t       size;   // Allocated size in bytes
+		};
+
+		static const UInt   mSourcesTableSize = 8192; // Size of sources statistics table, must be power of two
+		static const size_t mHeaderSize = sizeof(AllocHeader) > alignof(std::max_align_t) ?
+			sizeof(AllocHeader) : alignof(std::max_align_t); // Allocation header size with padding
+
 		static MemoryManager* mInstance; // Instance pointer
 
-		std::map<void*, AllocInfo> mAllocs;     // Allocations info
-		size_t                     mTotalBytes; // Total managed allocated bytes
+		static SourceStats                  mSources[mSourcesTableSize]; // Allocations sources statistics hash table
+		static std::mutex                   mSourcesMutex;               // Sources registering mutex
+		static std::atomic<ThreadCounters*> mThreadsCounters;            // List of all threads counters
+
+		static thread_local ThreadCounters* mCurrentThreadCounters; // Current thread counters
 
 	protected:
-		// It is called when memory was allocated and registers allocation
-		void OnMemoryAllocate(void* memory, size_t size, const char* source, int line);
+		// Allocates memory with header and registers it in statistics. Source can be null
+		static void* Allocate(size_t size, const char* source, int line);
+
+		// Unregisters and releases memory allocated by Allocate
+		static void Release(void* memory);
+
+		// Returns statistics for source and line, registers when it is first allocation from there. 
+		// Returns null when table is full
+		static SourceStats* GetSourceStats(const char* source, int line);
+
+		// Returns current thread counters, registers it when it is first allocation in thread
+		static ThreadCounters& GetThreadCounters();
 
-		// It is called when memory releasing, unregisters allocation
-		void OnMemoryRelease(void* memory);
+		// Increases counter, owned by current thread
+		static void IncreaseThreadCounter(std::atomic<Int64>& counter, Int64 value);
 
 		friend void* ::operator new(size_t size, const char* location, int line);
 		friend void* ::operator new[](size_t size, const char* location, int line);
+#if ENALBE_MEMORY_MANAGE == true
+		friend void* ::operator new(size_t size);
+#endif
 		friend void  ::operator delete(void* allocMemory) noexcept;
 		friend void* ::_mmalloc(size_t size, const char* location, int line);
 		friend void  ::_mfree(void* allocMemory);
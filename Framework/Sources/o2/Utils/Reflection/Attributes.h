@@ -4,6 +4,7 @@ namespace o2
 {
 	class FieldInfo;
 	class Type;
+	struct DataMemberKey;
 
 	// ----------------------------------------
 	// Attribute interface. Using in reflection
@@ -21,10 +22,10 @@ namespace o2
 		struct SerializeProcessorMixin: public _base
 		{
 			template<typename _object_type, typename _field_type>
-			SerializeProcessorMixin<_base>& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-														_field_type& field)
+			SerializeProcessorMixin<_base>& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+														void*(*pointerGetter)(void*), _field_type& field)
 			{
-				_base::FieldBasics(object, type, name, pointerGetter, field);
+				_base::FieldBasics(object, type, name, key, pointerGetter, field);
 				return *this;
 			}
 		};
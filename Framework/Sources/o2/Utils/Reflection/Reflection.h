@@ -23,6 +23,7 @@ namespace o2
 	class StaticFunctionInfo;
 	class Type;
 	class VectorType;
+	struct DataMemberKey;
 	struct IDefaultValue;
 
 	template<typename _return_type, typename _accessor_type>
@@ -141,8 +142,8 @@ namespace o2
 			FieldProcessor& SetDefaultValue(const _type& value);
 
 			template<typename _object_type, typename _field_type>
-			FieldInfo& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-								   _field_type& field);
+			FieldInfo& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+								   void*(*pointerGetter)(void*), _field_type& field);
 		};
 
 		template<typename _object_type>
@@ -386,6 +387,7 @@ namespace o2
 	template<typename _object_type, typename _field_type>
 	FieldInfo& ReflectionInitializationTypeProcessor::FieldProcessor::FieldBasics(_object_type* object, Type* type, 
 																					const char* name, 
+																					const DataMemberKey& key,
 																					void*(*pointerGetter)(void*), 
 																					_field_type& field)
 	{
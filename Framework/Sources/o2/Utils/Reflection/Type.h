@@ -6,6 +6,7 @@
 #include "o2/Utils/Reflection/Attributes.h"
 #include "o2/Utils/Reflection/TypeSerializer.h"
 #include "o2/Utils/Reflection/TypeTraits.h"
+#include "o2/Utils/Serialization/DataMemberKey.h"
 #include "o2/Utils/Types/CommonTypes.h"
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
@@ -707,7 +708,9 @@ typedef void*(*GetValuePointerFuncPtr)(void*);
     processor.StartField()
 
 #define NAME(NAME) \
-    template FieldBasics<thisclass, decltype(object->NAME)>(object, type, #NAME, (GetValuePointerFuncPtr)([](void* obj) { return (void*)&((thisclass*)obj)->NAME; }), object->NAME)
+    template FieldBasics<thisclass, decltype(object->NAME)>(object, type, #NAME,                                          \
+        []() -> const o2::DataMemberKey& { static constexpr o2::DataMemberKey key(#NAME); return key; }(),                \
+        (GetValuePointerFuncPtr)([](void* obj) { return (void*)&((thisclass*)obj)->NAME; }), object->NAME)
 
 #define PUBLIC() \
 	SetProtectSection(o2::ProtectSection::Public)
@@ -0,0 +1,395 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+#include <string_view>
+#include <unordered_map>
+#include "o2/Utils/Serialization/JsonDataFormat.h"
+
+namespace o2
+{
+	static constexpr char binarySignature[] = { 'o', '2', 'B', 'D' };
+	static constexpr UInt8 binaryVersion = 1;
+	static constexpr UInt binaryHeaderSize = sizeof(binarySignature) + sizeof(binaryVersion);
+
+	// Value type tag
+	enum class BinaryDataTag: UInt8 { Null, False, True, Int, UInt, Int64, UInt64, Double, String, Object, Array };
+
+	// ----------------------------------------------------------------
+	// Binary data writer, implements writer used by DataValue::Write()
+	// ----------------------------------------------------------------
+	class BinaryDataWriter
+	{
+	public:
+		// Writes null value
+		void Null() { WriteTag(BinaryDataTag::Null); }
+
+		// Writes boolean value
+		void Bool(bool value) { WriteTag(value ? BinaryDataTag::True : BinaryDataTag::False); }
+
+		// Writes integer value
+		void Int(int value) { WriteTag(BinaryDataTag::Int); WriteVarInt(mValues, ZigZag(value)); }
+
+		// Writes unsigned integer value
+		void Uint(unsigned value) { WriteTag(BinaryDataTag::UInt); WriteVarInt(mValues, value); }
+
+		// Writes 64 bit integer value
+		void Int64(int64_t value) { WriteTag(BinaryDataTag::Int64); WriteVarInt(mValues, ZigZag(value)); }
+
+		// Writes 64 bit unsigned integer value
+		void Uint64(uint64_t value) { WriteTag(BinaryDataTag::UInt64); WriteVarInt(mValues, value); }
+
+		// Writes double value
+		void Double(double value)
+		{
+			WriteTag(BinaryDataTag::Double);
+			WriteRaw(&value, sizeof(value));
+		}
+
+		// Writes string value
+		void String(const char* str, unsigned length, bool copy)
+		{
+			WriteTag(BinaryDataTag::String);
+			WriteStringIndex(str, length);
+		}
+
+		// Writes object member name
+		void Key(const char* str, unsigned length, bool copy)
+		{
+			WriteStringIndex(str, length);
+		}
+
+		// Starts object, writes members count placeholder
+		void StartObject()
+		{
+			WriteTag(BinaryDataTag::Object);
+			StartCount();
+		}
+
+		// Ends object, writes members count
+		void EndObject(unsigned memberCount)
+		{
+			EndCount(memberCount);
+		}
+
+		// Starts array, writes elements count placeholder
+		void StartArray()
+		{
+			WriteTag(BinaryDataTag::Array);
+			StartCount();
+		}
+
+		// Ends array, writes elements count
+		void EndArray(unsigned elementCount)
+		{
+			EndCount(elementCount);
+		}
+
+		// Writes header, strings table and values into data
+		void Finish(Vector<char>& data)
+		{
+			data.Clear();
+			data.Reserve(binaryHeaderSize + mStringsSize + mValues.Count());
+
+			data.insert(data.end(), binarySignature, binarySignature + sizeof(binarySignature));
+			data.Add((char)binaryVersion);
+
+			WriteVarInt(data, mStrings.Count());
+			for (auto& str : mStrings)
+			{
+				WriteVarInt(data, str.length());
+				data.insert(data.end(), str.data(), str.data() + str.length());
+				data.Add('\0');
+			}
+
+			data.insert(data.end(), mValues.begin(), mValues.end());
+		}
+
+	protected:
+		Vector<char> mValues;          // Values tree data
+		Vector<int>  mCountsPositions; // Positions of objects and arrays counts placeholders, that not ended yet
+
+		Vector<std::string_view>                   mStrings;         // Strings table
+		std::unordered_map<std::string_view, UInt> mStringsIndexes;  // Strings indexes in table
+		UInt                                       mStringsSize = 0; // Approximate strings table size
+
+	protected:
+		// Encodes signed value for varint
+		static UInt64 ZigZag(::Int64 value)
+		{
+			return ((UInt64)value << 1) ^ (UInt64)(value >> 63);
+		}
+
+		// Writes unsigned varint
+		static void WriteVarInt(Vector<char>& data, UInt64 value)
+		{
+			while (value >= 0x80)
+			{
+				data.Add((char)((value & 0x7f) | 0x80));
+				value >>= 7;
+			}
+
+			data.Add((char)value);
+		}
+
+		// Writes raw bytes
+		void WriteRaw(const void* src, UInt size)
+		{
+			mValues.insert(mValues.end(), (const char*)src, (const char*)src + size);
+		}
+
+		// Writes type tag
+		void WriteTag(BinaryDataTag tag)
+		{
+			mValues.Add((char)tag);
+		}
+
+		// Writes string index in table, registers string when required
+		void WriteStringIndex(const char* str, unsigned length)
+		{
+			std::string_view view(str, length);
+			auto fnd = mStringsIndexes.find(view);
+			if (fnd != mStringsIndexes.end())
+			{
+				WriteVarInt(mValues, fnd->second);
+				return;
+			}
+
+			UInt idx = mStrings.Count();
+			mStrings.Add(view);
+			mStringsIndexes[view] = idx;
+			mStringsSize += length + 2;
+
+			WriteVarInt(mValues, idx);
+		}
+
+		// Writes count placeholder
+		void StartCount()
+		{
+			mCountsPositions.Add(mValues.Count());
+
+			UInt placeholder = 0;
+			WriteRaw(&placeholder, sizeof(placeholder));
+		}
+
+		// Writes count into last placeholder
+		void EndCount(UInt count)
+		{
+			int position = mCountsPositions.PopBack();
+			memcpy(mValues.Data() + position, &count, sizeof(count));
+		}
+	};
+
+	// ---------------------------------------------------------------------------
+	// Binary data reader. Checks bounds, sends values into document parse handler
+	// ---------------------------------------------------------------------------
+	class BinaryDataReader
+	{
+	public:
+		// Constructor
+		BinaryDataReader(char* data, UInt size, JsonDataDocumentParseHandler& handler):
+			mCurrent(data), mEnd(data + size), mHandler(handler)
+		{}
+
+		// Reads header, strings table and values
+		bool Read()
+		{
+			mCurrent += binaryHeaderSize;
+
+			UInt64 stringsCount;
+			if (!ReadVarInt(stringsCount) || stringsCount > (UInt64)(mEnd - mCurrent))
+				return false;
+
+			mStrings.Reserve((int)stringsCount);
+			for (UInt64 i = 0; i < stringsCount; i++)
+			{
+				UInt64 length;
+				if (!ReadVarInt(length) || length + 1 > (UInt64)(mEnd - mCurrent) || mCurrent[length] != '\0')
+					return false;
+
+				mStrings.Add(std::string_view(mCurrent, (size_t)length));
+				mCurrent += length + 1;
+			}
+
+			return ReadValue(0);
+		}
+
+	protected:
+		static constexpr int maxDepth = 512; // Maximal nesting depth, protects from stack overflow on broken data
+
+		char* mCurrent; // Current reading position
+		char* mEnd;     // End of data
+
+		JsonDataDocumentParseHandler& mHandler; // Document building handler
+
+		Vector<std::string_view> mStrings; // Strings table
+
+	protected:
+		// Reads unsigned varint
+		bool ReadVarInt(UInt64& value)
+		{
+			value = 0;
+			for (int shift = 0; shift < 64; shift += 7)
+			{
+				if (mCurrent >= mEnd)
+					return false;
+
+				UInt8 byte = (UInt8)*mCurrent++;
+				value |= (UInt64)(byte & 0x7f) << shift;
+
+				if ((byte & 0x80) == 0)
+					return true;
+			}
+
+			return false;
+		}
+
+		// Reads signed zigzag varint
+		bool ReadSignedVarInt(::Int64& value)
+		{
+			UInt64 raw;
+			if (!ReadVarInt(raw))
+				return false;
+
+			value = (::Int64)(raw >> 1) ^ -(::Int64)(raw & 1);
+			return true;
+		}
+
+		// Reads raw bytes
+		bool ReadRaw(void* dst, UInt size)
+		{
+			if ((UInt64)(mEnd - mCurrent) < size)
+				return false;
+
+			memcpy(dst, mCurrent, size);
+			mCurrent += size;
+			return true;
+		}
+
+		// Reads string from table by index
+		bool ReadString(std::string_view& str)
+		{
+			UInt64 idx;
+			if (!ReadVarInt(idx) || idx >= (UInt64)mStrings.Count())
+				return false;
+
+			str = mStrings[(int)idx];
+			return true;
+		}
+
+		// Reads value with children
+		bool ReadValue(int depth)
+		{
+			if (mCurrent >= mEnd || depth > maxDepth)
+				return false;
+
+			BinaryDataTag tag = (BinaryDataTag)*mCurrent++;
+			switch (tag)
+			{
+			case BinaryDataTag::Null:
+				return mHandler.Null();
+
+			case BinaryDataTag::False:
+				return mHandler.Bool(false);
+
+			case BinaryDataTag::True:
+				return mHandler.Bool(true);
+
+			case BinaryDataTag::Int:
+			{
+				::Int64 value;
+				return ReadSignedVarInt(value) && mHandler.Int((int)value);
+			}
+
+			case BinaryDataTag::UInt:
+			{
+				UInt64 value;
+				return ReadVarInt(value) && mHandler.Uint((unsigned)value);
+			}
+
+			case BinaryDataTag::Int64:
+			{
+				::Int64 value;
+				return ReadSignedVarInt(value) && mHandler.Int64(value);
+			}
+
+			case BinaryDataTag::UInt64:
+			{
+				UInt64 value;
+				return ReadVarInt(value) && mHandler.Uint64(value);
+			}
+
+			case BinaryDataTag::Double:
+			{
+				double value;
+				return ReadRaw(&value, sizeof(value)) && mHandler.Double(value);
+			}
+
+			case BinaryDataTag::String:
+			{
+				std::string_view str;
+				return ReadString(str) && mHandler.String(str.data(), (unsigned)str.length(), false);
+			}
+
+			case BinaryDataTag::Object:
+			{
+				UInt count;
+				if (!ReadRaw(&count, sizeof(count)) || !mHandler.StartObject())
+					return false;
+
+				for (UInt i = 0; i < count; i++)
+				{
+					std::string_view name;
+					if (!ReadString(name) || !mHandler.Key(name.data(), (unsigned)name.length(), false) || !ReadValue(depth + 1))
+						return false;
+				}
+
+				return mHandler.EndObject(count);
+			}
+
+			case BinaryDataTag::Array:
+			{
+				UInt count;
+				if (!ReadRaw(&count, sizeof(count)) || !mHandler.StartArray())
+					return false;
+
+				for (UInt i = 0; i < count; i++)
+				{
+					if (!ReadValue(depth + 1))
+						return false;
+				}
+
+				return mHandler.EndArray(count);
+			}
+			}
+
+			return false;
+		}
+	};
+
+	bool IsBinaryData(const char* data, UInt size)
+	{
+		return size >= binaryHeaderSize && memcmp(data, binarySignature, sizeof(binarySignature)) == 0 &&
+			(UInt8)data[sizeof(binarySignature)] == binaryVersion;
+	}
+
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document)
+	{
+		if (!IsBinaryData(data, size))
+			return false;
+
+		JsonDataDocumentParseHandler handler(document);
+		BinaryDataReader reader(data, size, handler);
+		if (!reader.Read())
+			return false;
+
+		(DataValue&)document = std::move(*handler.stack.Pop<DataValue>());
+		return true;
+	}
+
+	void WriteBinary(Vector<char>& data, const DataDocument& document)
+	{
+		BinaryDataWriter writer;
+		document.Write(writer);
+		writer.Finish(data);
+	}
+}
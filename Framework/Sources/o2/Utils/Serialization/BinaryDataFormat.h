@@ -0,0 +1,25 @@
+#pragma once
+#include "DataValue.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Binary data document format. Layout:
+	// - signature "o2BD" and format version byte
+	// - strings table: varint strings count, then each string as varint length, characters and zero 
+	//   terminator. Member names and string values are deduplicated here, so loaded document
+	//   references strings right in the loaded buffer without copying
+	// - values tree: type tag byte and payload. Integers are varints (signed are zigzag encoded), 
+	//   doubles are 8 bytes, strings are varint indexes in table, objects and arrays are 4 bytes count 
+	//   and members (name index and value) or elements
+	// -----------------------------------------------------------------------------------------------
+
+	// Returns true when data starts with binary data document signature
+	bool IsBinaryData(const char* data, UInt size);
+
+	// Parses binary document into DataDocument. Strings are referenced to buffer, so it must live as long as document
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document);
+
+	// Writes data into binary buffer
+	void WriteBinary(Vector<char>& data, const DataDocument& document);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Precomputed object member key: name, its length and hash. Can be created at compile time from
+	// string literal, so member search doesn't calculate name length and hash and doesn't build
+	// temporary name value. Example: static constexpr DataMemberKey typeKey("Type"). Reflection
+	// NAME() macro builds key for each field, it is used in fields deserialization
+	// -----------------------------------------------------------------------------------------------
+	struct DataMemberKey
+	{
+		const char* name;   // Member name, not owned
+		UInt        length; // Member name length
+		UInt        hash;   // Member name hash
+
+	public:
+		// Constructor from string literal
+		template<UInt _size>
+		constexpr DataMemberKey(const char(&name)[_size]);
+
+		// Constructor from string with length
+		constexpr DataMemberKey(const char* name, UInt length);
+
+		// Returns FNV-1a hash of string
+		static constexpr UInt Hash(const char* str, UInt length);
+	};
+
+	template<UInt _size>
+	constexpr DataMemberKey::DataMemberKey(const char(&name)[_size]):
+		name(name), length(_size - 1), hash(Hash(name, _size - 1))
+	{}
+
+	constexpr DataMemberKey::DataMemberKey(const char* name, UInt length):
+		name(name), length(length), hash(Hash(name, length))
+	{}
+
+	constexpr UInt DataMemberKey::Hash(const char* str, UInt length)
+	{
+		UInt hash = 2166136261u;
+		for (UInt i = 0; i < length; i++)
+			hash = (hash ^ (UInt)(unsigned char)str[i])*16777619u;
+
+		return hash;
+	}
+}
@@ -2,6 +2,7 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -390,13 +391,21 @@ namespace o2
 
 	DataValue& DataValue::GetMember(const char* name)
 	{
-		DataValue t(name);
-		return GetMember(t);
+		if (auto res = FindMember(name))
+			return *res;
+
+		return AddMember(name);
 	}
 
 	const DataValue& DataValue::GetMember(const char* name) const
 	{
-		return GetMember(DataValue(name));
+		if (auto res = FindMember(name))
+			return *res;
+
+		Assert(false, "Can't find data member");
+
+		static DataValue empty;
+		return empty;
 	}
 
 	DataValue* DataValue::FindMember(const DataValue& name)
@@ -404,6 +413,14 @@ namespace o2
 		if (!IsObject())
 			return nullptr;
 
+		if (name.IsString())
+		{
+			if (auto member = FindMemberByKey(DataMemberKey(name.GetString(), name.GetStringLength())))
+				return &member->value;
+
+			return nullptr;
+		}
+
 		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
 		{
 			if (memberIt->name == name)
@@ -414,27 +431,132 @@ namespace o2
 	}
 
 	const DataValue* DataValue::FindMember(const DataValue& name) const
+	{
+		return const_cast<DataValue*>(this)->FindMember(name);
+	}
+
+	DataValue* DataValue::FindMember(const char* name)
 	{
 		if (!IsObject())
 			return nullptr;
 
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
+		if (auto member = FindMemberByKey(DataMemberKey(name, (UInt)strlen(name))))
+			return &member->value;
+
+		return nullptr;
+	}
+
+	const DataValue* DataValue::FindMember(const char* name) const
+	{
+		return const_cast<DataValue*>(this)->FindMember(name);
+	}
+
+	DataValue* DataValue::FindMember(const DataMemberKey& key)
+	{
+		if (!IsObject())
+			return nullptr;
+
+		if (auto member = FindMemberByKey(key))
+			return &member->value;
+
+		return nullptr;
+	}
+
+	const DataValue* DataValue::FindMember(const DataMemberKey& key) const
+	{
+		return const_cast<DataValue*>(this)->FindMember(key);
+	}
+
+	DataMember* DataValue::FindMemberByKey(const DataMemberKey& key) const
+	{
+		auto isMemberName = [&](const DataMember& member) {
+			return member.name.IsString() && (UInt)member.name.GetStringLength() == key.length &&
+				memcmp(member.name.GetString(), key.name, key.length) == 0;
+		};
+
+		if (mData.flagsData.Is(Flags::MembersIndexed))
 		{
-			if (memberIt->name == name)
-				return &memberIt->value;
+			MemberIndexEntry* index = GetMembersIndex();
+			UInt mask = GetMembersIndexSize(mData.objectData.capacity) - 1;
+
+			for (UInt i = key.hash & mask; index[i].memberIdx != 0; i = (i + 1) & mask)
+			{
+				DataMember& member = mData.objectData.members[index[i].memberIdx - 1];
+				if (index[i].hash == key.hash && isMemberName(member))
+					return &member;
+			}
+
+			return nullptr;
+		}
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+		{
+			DataMember& member = mData.objectData.members[i];
+			if (isMemberName(member))
+				return &member;
 		}
 
 		return nullptr;
 	}
 
-	DataValue* DataValue::FindMember(const char* name)
+	UInt DataValue::GetMembersIndexSize(UInt capacity)
 	{
-		return FindMember(DataValue(name));
+		if (capacity < ObjectIndexMinMembers)
+			return 0;
+
+		UInt size = 1;
+		while (size < capacity*2)
+			size <<= 1;
+
+		return size;
 	}
 
-	const DataValue* DataValue::FindMember(const char* name) const
+	size_t DataValue::GetMembersAllocationSize(UInt capacity)
 	{
-		return FindMember(DataValue(name));
+		return sizeof(DataMember)*capacity + sizeof(MemberIndexEntry)*GetMembersIndexSize(capacity);
+	}
+
+	DataValue::MemberIndexEntry* DataValue::GetMembersIndex() const
+	{
+		return (MemberIndexEntry*)(mData.objectData.members + mData.objectData.capacity);
+	}
+
+	void DataValue::BuildMembersIndex()
+	{
+		UInt size = GetMembersIndexSize(mData.objectData.capacity);
+		UInt mask = size - 1;
+
+		MemberIndexEntry* index = GetMembersIndex();
+		memset(index, 0, sizeof(MemberIndexEntry)*size);
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+		{
+			const DataValue& name = mData.objectData.members[i].name;
+			if (!name.IsString())
+				continue;
+
+			UInt hash = DataMemberKey::Hash(name.GetString(), name.GetStringLength());
+
+			UInt pos = hash & mask;
+			while (index[pos].memberIdx != 0)
+				pos = (pos + 1) & mask;
+
+			index[pos].hash = hash;
+			index[pos].memberIdx = i + 1;
+		}
+
+		mData.flagsData.flags = Flags::Object | Flags::MembersIndexed;
+	}
+
+	void DataValue::UpdateMembersIndex()
+	{
+		if (!IsObject())
+			return;
+
+		if (GetMembersIndexSize(mData.objectData.capacity) > 0)
+			BuildMembersIndex();
+		else
+			mData.flagsData.flags = Flags::Object;
 	}
 
 	void DataValue::SetObject()
@@ -444,7 +566,7 @@ namespace o2
 
 		mData.flagsData.flags = Flags::Object;
 
-		mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
+		mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(GetMembersAllocationSize(ObjectInitialCapacity));
 		mData.objectData.capacity = ObjectInitialCapacity;
 		mData.objectData.count = 0;
 	}
@@ -460,15 +582,17 @@ namespace o2
 				UInt newCapacity = Math::Max(mData.objectData.capacity*2, ObjectInitialCapacity);
 				mData.objectData.members = (DataMember*)mDocument->mAllocator.Reallocate(
 					mData.objectData.members, sizeof(DataMember)*mData.objectData.capacity,
-					sizeof(DataMember)*newCapacity);
+					GetMembersAllocationSize(newCapacity));
 
 				mData.objectData.capacity = newCapacity;
 			}
 			else
 			{
-				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
+				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(GetMembersAllocationSize(ObjectInitialCapacity));
 				mData.objectData.capacity = ObjectInitialCapacity;
 			}
+
+			UpdateMembersIndex();
 		}
 
 		DataMember* newMember =
@@ -476,6 +600,21 @@ namespace o2
 
 		mData.objectData.count++;
 
+		// New member is appended to index, not string names aren't indexed and are searched linearly
+		if (mData.flagsData.Is(Flags::MembersIndexed) && newMember->name.IsString())
+		{
+			UInt hash = DataMemberKey::Hash(newMember->name.GetString(), newMember->name.GetStringLength());
+			UInt mask = GetMembersIndexSize(mData.objectData.capacity) - 1;
+			MemberIndexEntry* index = GetMembersIndex();
+
+			UInt pos = hash & mask;
+			while (index[pos].memberIdx != 0)
+				pos = (pos + 1) & mask;
+
+			index[pos].hash = hash;
+			index[pos].memberIdx = mData.objectData.count;
+		}
+
 		return newMember->value;
 	}
 
@@ -495,6 +634,7 @@ namespace o2
 			{
 				*memberIt = *(mData.objectData.members + mData.objectData.count - 1);
 				mData.objectData.count--;
+				UpdateMembersIndex();
 				break;
 			}
 		}
@@ -507,6 +647,7 @@ namespace o2
 
 		*it = *(mData.objectData.members + mData.objectData.count - 1);
 		mData.objectData.count--;
+		UpdateMembersIndex();
 
 		return it;
 	}
@@ -672,7 +813,10 @@ namespace o2
 	void DataValue::Clear()
 	{
 		if (IsObject())
+		{
 			mData.objectData.count = 0;
+			UpdateMembersIndex();
+		}
 		else if (IsArray())
 			mData.arrayData.count = 0;
 		else
@@ -688,12 +832,16 @@ namespace o2
 	{}
 
 	DataDocument::DataDocument(DataDocument&& other) :
-		DataValue(other), mAllocator(other.mAllocator)
-	{}
+		DataValue(other), mAllocator(other.mAllocator), mMappedFiles(other.mMappedFiles)
+	{
+		// Moved values can reference mapped files data, so files are owned by this document now
+		other.mMappedFiles.Clear();
+	}
 
 	DataDocument::~DataDocument()
 	{
 		mAllocator.Clear();
+		ReleaseMappedFiles();
 	}
 
 	bool DataDocument::operator!=(const DataDocument& other) const
@@ -716,18 +864,40 @@ namespace o2
 	{
 		DataValue::operator=(other);
 		mAllocator = other.mAllocator;
+
+		ReleaseMappedFiles();
+		mMappedFiles = other.mMappedFiles;
+		other.mMappedFiles.Clear();
+
 		return *this;
 	}
 
 	bool DataDocument::LoadFromFile(const String& fileName, Format format /*= Format::JSON*/)
 	{
-		InFile file(fileName);
-		if (!file.IsOpened())
+		InFile* file = mnew InFile(fileName);
+		if (!file->IsOpened())
+		{
+			delete file;
 			return false;
+		}
+
+		// Previously loaded values are replaced, so their mapped files aren't needed anymore
+		ReleaseMappedFiles();
+
+		// Parsing in place from mapped file when possible, file must live while document values use its data
+		auto size = file->GetDataSize();
+		char* data = file->MapFullData();
+		if (data)
+			mMappedFiles.Add(file);
+		else
+		{
+			data = (char*)mAllocator.Allocate(size);
+			file->ReadData(data, size);
+			delete file;
+		}
 
-		auto size = file.GetDataSize();
-		char* data = (char*)mAllocator.Allocate(size);
-		file.ReadData(data, size);
+		if (format == Format::Binary || IsBinaryData(data, size))
+			return ParseBinaryInplace(data, size, *this);
 
 		if (format == Format::JSON)
 			return ParseJsonInplace(data, *this);
@@ -735,8 +905,18 @@ namespace o2
 		return false;
 	}
 
+	void DataDocument::ReleaseMappedFiles()
+	{
+		for (auto file : mMappedFiles)
+			delete file;
+
+		mMappedFiles.Clear();
+	}
+
 	bool DataDocument::LoadFromData(const String& data, Format format /*= Format::JSON*/)
 	{
+		ReleaseMappedFiles();
+
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
@@ -745,6 +925,19 @@ namespace o2
 
 	bool DataDocument::SaveToFile(const String& fileName, Format format /*= Format::JSON*/) const
 	{
+		if (format == Format::Binary)
+		{
+			Vector<char> data;
+			WriteBinary(data, *this);
+
+			OutFile file(fileName);
+			if (!file.IsOpened())
+				return false;
+
+			file.WriteData(data.Data(), data.Count());
+			return true;
+		}
+
 		String data = SaveAsString(format);
 
 		OutFile file(fileName);
@@ -753,7 +946,7 @@ namespace o2
 
 		file.WriteData(data.Data(), data.Length());
 
-		return false;
+		return true;
 	}
 
 	String DataDocument::SaveAsString(Format format /*= Format::JSON*/) const
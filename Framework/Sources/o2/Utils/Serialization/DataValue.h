@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Memory/Allocators/ChunkPoolAllocator.h"
 #include "o2/Utils/Property.h"
+#include "o2/Utils/Serialization/DataMemberKey.h"
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
@@ -14,6 +15,7 @@
 namespace o2
 {
 	class ISerializable;
+	class InFile;
 
 	class DataDocument;
 	struct DataMember;
@@ -259,6 +261,12 @@ namespace o2
 		// Returns node by name.
 		const DataValue* FindMember(const char* name) const;
 
+		// Returns node by precomputed key
+		DataValue* FindMember(const DataMemberKey& key);
+
+		// Returns node by precomputed key
+		const DataValue* FindMember(const DataMemberKey& key) const;
+
 		// Add new node with name
 		DataValue& AddMember(DataValue& name);
 
@@ -317,7 +325,9 @@ namespace o2
 
 			ShortString = 1 << 13,
 			StringRef = 1 << 14,
-			StringCopy = 1 << 15
+			StringCopy = 1 << 15,
+
+			MembersIndexed = 1 << 16
 		};
 
 	protected:
@@ -327,6 +337,8 @@ namespace o2
 		static constexpr UInt ObjectInitialCapacity = 7;
 		static constexpr UInt ArrayInitialCapacity = 7;
 
+		static constexpr UInt ObjectIndexMinMembers = 16; // Members count, from which members are searched by hash index
+
 		struct IntData
 		{
 			int intValue;
@@ -372,6 +384,8 @@ namespace o2
 			}
 		};
 
+		// Object members are allocated in one block with members hash index, that placed after members. 
+		// Index is allocated only for big capacity, see GetMembersIndexSize()
 		struct ObjectData
 		{
 			DataMember* members;
@@ -379,6 +393,13 @@ namespace o2
 			UInt capacity;
 		};
 
+		// Members hash index entry. Member index is shifted by one, zero is empty entry
+		struct MemberIndexEntry
+		{
+			UInt hash;
+			UInt memberIdx;
+		};
+
 		struct ArrayData
 		{
 			DataValue* elements;
@@ -409,6 +430,25 @@ namespace o2
 		// Constructor temporary string reference
 		explicit DataValue(const char* stringRef);
 
+		// Returns members hash index entries count for members capacity. Zero when index isn't used
+		static UInt GetMembersIndexSize(UInt capacity);
+
+		// Returns members block size in bytes, including hash index
+		static size_t GetMembersAllocationSize(UInt capacity);
+
+		// Returns members hash index entries
+		MemberIndexEntry* GetMembersIndex() const;
+
+		// Builds members hash index
+		void BuildMembersIndex();
+
+		// Rebuilds members hash index, when members capacity is enough for it. Index is always actual, so
+		// const search doesn't modify value and can be used from several threads
+		void UpdateMembersIndex();
+
+		// Searches member by name, length and hash
+		DataMember* FindMemberByKey(const DataMemberKey& key) const;
+
 		// Transcode wide char to char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF8<>>& target, const wchar_t* source);
 
@@ -475,6 +515,12 @@ namespace o2
 	protected:
 		ChunkPoolAllocator mAllocator;
 
+		Vector<InFile*> mMappedFiles; // Files with memory mapped data, used by document values in place
+
+	protected:
+		// Closes and deletes memory mapped files. Values must not reference their data
+		void ReleaseMappedFiles();
+
 		friend class DataValue;
 		friend class JsonDataDocumentParseHandler;
 	};
@@ -1222,9 +1268,12 @@ namespace o2
 
 		static void Read(T& value, const DataValue& data)
 		{
-			if (auto typeNode = data.FindMember("Type"))
+			static constexpr DataMemberKey typeKey("Type");
+			static constexpr DataMemberKey valueKey("Value");
+
+			if (auto typeNode = data.FindMember(typeKey))
 			{
-				if (auto valueNode = data.FindMember("Value"))
+				if (auto valueNode = data.FindMember(valueKey))
 				{
 					if (value)
 						delete value;
@@ -1299,13 +1348,16 @@ namespace o2
 
 		static void Read(Map<_key, _value>& value, const DataValue& data)
 		{
+			static constexpr DataMemberKey keyKey("Key");
+			static constexpr DataMemberKey valueKey("Value");
+
 			if (data.IsArray())
 			{
 				value.Clear();
 				for (auto& childNode : data)
 				{
-					auto keyNode = childNode.FindMember("Key");
-					auto valueNode = childNode.FindMember("Value");
+					auto keyNode = childNode.FindMember(keyKey);
+					auto valueNode = childNode.FindMember(valueKey);
 
 					if (keyNode && valueNode)
 					{
@@ -215,8 +215,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-							  _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+							  void*(*pointerGetter)(void*), _field_type& field)
 			{
 				if (!CheckSerialize(object, type, name, pointerGetter, field))
 					return *this;
@@ -263,8 +263,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-							  _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+							  void*(*pointerGetter)(void*), _field_type& field)
 			{
 				if (!CheckSerialize(object, type, name, pointerGetter, field))
 					return *this;
@@ -294,12 +294,12 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-							  _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+							  void*(*pointerGetter)(void*), _field_type& field)
 			{
 				_field_type* fieldPtr = (_field_type*)((*pointerGetter)(object));
 
-				if (auto m = node.FindMember(name))
+				if (auto m = node.FindMember(key))
 					m->Get(*fieldPtr);
 
 				return *this;
@@ -343,8 +343,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-												 _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+												 void*(*pointerGetter)(void*), _field_type& field)
 			{
 				if (!CheckSerialize(object, type, name, pointerGetter, field))
 					return *this;
@@ -379,13 +379,13 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-												   _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+												   void*(*pointerGetter)(void*), _field_type& field)
 			{
 				_field_type* fieldPtr = (_field_type*)((*pointerGetter)(object));
 				_field_type* originFieldPtr = (_field_type*)((*pointerGetter)(const_cast<_object_type*>(&origin)));
 
-				if (auto m = node.FindMember(name); m && !m->IsNull())
+				if (auto m = node.FindMember(key); m && !m->IsNull())
 					m->GetDelta(*fieldPtr, *originFieldPtr);
 				else
 				{
@@ -476,8 +476,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-							  _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+							  void*(*pointerGetter)(void*), _field_type& field)
 			{
 				if (!CheckSerialize(object, type, name, pointerGetter, field))
 					return *this;
@@ -520,8 +520,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			auto& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-							  _field_type& field)
+			auto& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+							  void*(*pointerGetter)(void*), _field_type& field)
 			{
 				if (!CheckSerialize(object, type, name, pointerGetter, field))
 					return *this;
@@ -85,8 +85,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-											_field_type& field)
+			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+											void*(*pointerGetter)(void*), _field_type& field)
 			{
 				return *this;
 			}
@@ -162,8 +162,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-											_field_type& field)
+			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+											void*(*pointerGetter)(void*), _field_type& field)
 			{
 				return *this;
 			}
@@ -235,8 +235,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-											_field_type& field)
+			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+											void*(*pointerGetter)(void*), _field_type& field)
 			{
 				return *this;
 			}
@@ -317,8 +317,8 @@ namespace o2
 			}
 
 			template<typename _object_type, typename _field_type>
-			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*),
-											_field_type& field)
+			BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, const DataMemberKey& key,
+											void*(*pointerGetter)(void*), _field_type& field)
 			{
 				return *this;
 			}
@@ -0,0 +1,181 @@
+#include "o2/stdafx.h"
+#include "JobSystem.h"
+
+#include "o2/Utils/Tasks/ParallelFor.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(JobSystem);
+
+	// Index of current thread jobs queue. Not worker threads use shared queue with index 0
+	static thread_local int currentQueueIndex = 0;
+
+	bool JobsCounter::IsDone() const
+	{
+		return mCount.load() == 0;
+	}
+
+	JobSystem::JobSystem()
+	{
+		int workersCount = GetWorkerThreadsCount() - 1;
+
+		for (int i = 0; i < workersCount + 1; i++)
+			mQueues.Add(mnew Queue());
+
+		for (int i = 0; i < workersCount; i++)
+			mThreads.Add(mnew std::thread([this, i]() { ThreadLoop(i + 1); }));
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mStopping = true;
+		}
+
+		mSleepCV.notify_all();
+
+		for (auto thread : mThreads)
+		{
+			thread->join();
+			delete thread;
+		}
+
+		for (auto queue : mQueues)
+			delete queue;
+	}
+
+	void JobSystem::Run(const Function<void()>& job, JobsCounter& counter)
+	{
+		counter.mCount++;
+
+		if (mThreads.IsEmpty())
+		{
+			job();
+			counter.mCount--;
+			return;
+		}
+
+		Queue* queue = mQueues[GetCurrentQueueIndex()];
+
+		{
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			queue->jobs.push_back({ job, &counter });
+			mQueuedJobsCount++;
+		}
+
+		// Empty lock is required to not lose wake up of worker, that is going to sleep
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+
+		mSleepCV.notify_one();
+	}
+
+	void JobSystem::Wait(JobsCounter& counter)
+	{
+		int queueIndex = GetCurrentQueueIndex();
+
+		while (!counter.IsDone())
+		{
+			if (!TryExecuteJob(queueIndex))
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::ParallelFor(int count, const Function<void(int)>& func, int batchSize /*= 1*/)
+	{
+		batchSize = Math::Max(batchSize, 1);
+		int batchesCount = (count + batchSize - 1)/batchSize;
+
+		if (batchesCount <= 1 || mThreads.IsEmpty())
+		{
+			for (int i = 0; i < count; i++)
+				func(i);
+
+			return;
+		}
+
+		JobsCounter counter;
+		for (int i = 0; i < batchesCount; i++)
+		{
+			int begin = i*batchSize;
+			int end = Math::Min(begin + batchSize, count);
+
+			Run([&func, begin, end]() {
+				for (int j = begin; j < end; j++)
+					func(j);
+			}, counter);
+		}
+
+		Wait(counter);
+	}
+
+	int JobSystem::GetThreadsCount() const
+	{
+		return mThreads.Count() + 1;
+	}
+
+	void JobSystem::ThreadLoop(int queueIndex)
+	{
+		currentQueueIndex = queueIndex;
+
+		while (!mStopping)
+		{
+			if (TryExecuteJob(queueIndex))
+				continue;
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCV.wait(lock, [&]() { return mStopping || mQueuedJobsCount > 0; });
+		}
+	}
+
+	bool JobSystem::TryExecuteJob(int queueIndex)
+	{
+		if (mQueuedJobsCount == 0)
+			return false;
+
+		Job job;
+		bool found = false;
+
+		// Own queue is used as stack, newest jobs have hot data in cache
+		{
+			Queue* queue = mQueues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				job = std::move(queue->jobs.back());
+				queue->jobs.pop_back();
+				found = true;
+			}
+		}
+
+		// Stealing oldest jobs from other queues, starting from next one to spread stealing threads
+		for (int i = 1; i < mQueues.Count() && !found; i++)
+		{
+			Queue* queue = mQueues[(queueIndex + i)%mQueues.Count()];
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				job = std::move(queue->jobs.front());
+				queue->jobs.pop_front();
+				found = true;
+			}
+		}
+
+		if (!found)
+			return false;
+
+		mQueuedJobsCount--;
+
+		job.func();
+		job.counter->mCount--;
+
+		return true;
+	}
+
+	int JobSystem::GetCurrentQueueIndex() const
+	{
+		return currentQueueIndex;
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Job system access macros
+#define o2Jobs o2::JobSystem::Instance()
+
+namespace o2
+{
+	// --------------------------------------------------------------------------------------------------
+	// Counter of not finished jobs. Waiting for counter returns when all jobs, started with it, are done
+	// --------------------------------------------------------------------------------------------------
+	class JobsCounter
+	{
+	public:
+		// Returns true when all jobs are done
+		bool IsDone() const;
+
+	protected:
+		std::atomic<int> mCount { 0 }; // Count of not finished jobs
+
+		friend class JobSystem;
+	};
+
+	// -------------------------------------------------------------------------------------------------
+	// Work-stealing job system. Each worker thread has own jobs queue: it takes newest jobs from own queue
+	// and steals oldest jobs from other queues when own queue is empty. Jobs from not worker threads are
+	// queued to shared queue. Waiting thread executes jobs too, so jobs can start other jobs and wait them
+	// -------------------------------------------------------------------------------------------------
+	class JobSystem: public Singleton<JobSystem>
+	{
+	public:
+		// Starts job. Counter is increased, and decreased when job is done
+		void Run(const Function<void()>& job, JobsCounter& counter);
+
+		// Waits until all counter jobs are done, executes queued jobs meanwhile
+		void Wait(JobsCounter& counter);
+
+		// Invokes function for each index from 0 to count by batches on worker threads and current thread.
+		// Returns when all are done. Function must be thread safe
+		void ParallelFor(int count, const Function<void(int)>& func, int batchSize = 1);
+
+		// Returns count of threads, executing jobs, including current thread
+		int GetThreadsCount() const;
+
+	protected:
+		struct Job
+		{
+			Function<void()> func;              // Job function
+			JobsCounter*     counter = nullptr; // Job counter, decreased when job is done
+		};
+
+		struct Queue
+		{
+			std::mutex      mutex; // Queue guard
+			std::deque<Job> jobs;  // Queued jobs
+		};
+
+	protected:
+		Vector<Queue*>       mQueues;  // Jobs queues. First queue is shared for not worker threads, others are workers own queues
+		Vector<std::thread*> mThreads; // Worker threads
+
+		std::atomic<int>  mQueuedJobsCount { 0 }; // Count of jobs in all queues
+		std::atomic<bool> mStopping { false };    // Is system stopping, workers exit when it is true
+
+		std::mutex              mSleepMutex; // Sleeping workers guard
+		std::condition_variable mSleepCV;    // Wakes up sleeping workers when job is queued
+
+	protected:
+		// Default constructor, starts worker threads
+		JobSystem();
+
+		// Destructor, stops worker threads. Queued jobs are dropped
+		~JobSystem();
+
+		// Worker thread function. Executes jobs and sleeps when there are no jobs
+		void ThreadLoop(int queueIndex);
+
+		// Takes job from own queue or steals it from other queue and executes it. Returns false when there are no jobs
+		bool TryExecuteJob(int queueIndex);
+
+		// Returns current thread queue index
+		int GetCurrentQueueIndex() const;
+
+		friend class Application;
+	};
+}
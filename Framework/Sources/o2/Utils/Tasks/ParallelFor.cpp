@@ -0,0 +1,50 @@
+#include "o2/stdafx.h"
+#include "ParallelFor.h"
+
+#include "o2/Utils/Tasks/JobSystem.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace o2
+{
+	int GetWorkerThreadsCount()
+	{
+		return Math::Max((int)std::thread::hardware_concurrency(), 1);
+	}
+
+	void ParallelFor(int count, const Function<void(int)>& func)
+	{
+		if (JobSystem::IsSingletonInitialzed())
+		{
+			o2Jobs.ParallelFor(count, func);
+			return;
+		}
+
+		int threadsCount = Math::Min(GetWorkerThreadsCount(), count);
+		if (threadsCount <= 1)
+		{
+			for (int i = 0; i < count; i++)
+				func(i);
+
+			return;
+		}
+
+		std::atomic<int> nextIndex(0);
+		auto worker = [&]() {
+			for (int i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1))
+				func(i);
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(threadsCount - 1);
+		for (int i = 0; i < threadsCount - 1; i++)
+			threads.emplace_back(worker);
+
+		worker();
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "o2/Utils/Function.h"
+
+namespace o2
+{
+	// Returns count of worker threads used for parallel processing
+	int GetWorkerThreadsCount();
+
+	// Invokes function for each index from 0 to count on worker threads and current thread. Returns when all are done.
+	// Uses job system threads when it is initialized. Function must be thread safe
+	void ParallelFor(int count, const Function<void(int)>& func);
+}
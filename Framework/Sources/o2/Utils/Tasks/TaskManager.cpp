@@ -1,7 +1,10 @@
 #include "o2/stdafx.h"
 #include "TaskManager.h"
 
+#include "o2/Application/Application.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/Tasks/Task.h"
+#include "o2/Utils/Types/Containers/ArenaVector.h"
 
 namespace o2
 {
@@ -61,7 +64,7 @@ namespace o2
 
 	void TaskManager::Update(float dt)
 	{
-		Vector<Task*> doneTasks;
+		ArenaVector<Task*> doneTasks(o2Application.GetFrameAllocator());
 		for (auto task : mTasks)
 		{
 			task->Update(dt);
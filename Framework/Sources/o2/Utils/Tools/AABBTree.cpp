@@ -0,0 +1,284 @@
+#include "o2/stdafx.h"
+#include "AABBTree.h"
+
+namespace o2
+{
+	AABBTree::AABBTree(float margin /*= 1.0f*/):
+		mMargin(margin)
+	{}
+
+	int AABBTree::Add(const RectF& aabb, void* userData)
+	{
+		int proxy = AllocateNode();
+		mNodes[proxy].aabb = Fatten(aabb);
+		mNodes[proxy].userData = userData;
+		mNodes[proxy].height = 0;
+
+		InsertLeaf(proxy);
+		mProxiesCount++;
+
+		return proxy;
+	}
+
+	void AABBTree::Remove(int proxy)
+	{
+		Assert(proxy >= 0 && proxy < mNodes.Count() && mNodes[proxy].IsLeaf(), "Invalid AABB tree proxy");
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		mProxiesCount--;
+	}
+
+	bool AABBTree::Move(int proxy, const RectF& aabb)
+	{
+		Assert(proxy >= 0 && proxy < mNodes.Count() && mNodes[proxy].IsLeaf(), "Invalid AABB tree proxy");
+
+		if (IsContains(mNodes[proxy].aabb, aabb))
+			return false;
+
+		RemoveLeaf(proxy);
+		mNodes[proxy].aabb = Fatten(aabb);
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void* AABBTree::GetUserData(int proxy) const
+	{
+		return mNodes[proxy].userData;
+	}
+
+	const RectF& AABBTree::GetFatAABB(int proxy) const
+	{
+		return mNodes[proxy].aabb;
+	}
+
+	int AABBTree::GetProxiesCount() const
+	{
+		return mProxiesCount;
+	}
+
+	int AABBTree::GetHeight() const
+	{
+		return mRoot < 0 ? 0 : mNodes[mRoot].height + 1;
+	}
+
+	void AABBTree::Clear()
+	{
+		mNodes.Clear();
+		mRoot = -1;
+		mFreeNodes = -1;
+		mProxiesCount = 0;
+	}
+
+	int AABBTree::AllocateNode()
+	{
+		if (mFreeNodes < 0)
+		{
+			mNodes.Add(Node());
+			return mNodes.Count() - 1;
+		}
+
+		int node = mFreeNodes;
+		mFreeNodes = mNodes[node].parent;
+		mNodes[node] = Node();
+
+		return node;
+	}
+
+	void AABBTree::FreeNode(int node)
+	{
+		mNodes[node].parent = mFreeNodes;
+		mNodes[node].height = -1;
+		mNodes[node].userData = nullptr;
+		mFreeNodes = node;
+	}
+
+	void AABBTree::InsertLeaf(int leaf)
+	{
+		if (mRoot < 0)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = -1;
+			return;
+		}
+
+		// Descending to sibling with minimal cost: perimeter of new branch plus inherited perimeters growth
+		RectF leafAABB = mNodes[leaf].aabb;
+		int sibling = mRoot;
+		while (!mNodes[sibling].IsLeaf())
+		{
+			const Node& node = mNodes[sibling];
+
+			float perimeter = GetPerimeter(node.aabb);
+			float combinedPerimeter = GetPerimeter(node.aabb.Expand(leafAABB));
+
+			float cost = 2.0f*combinedPerimeter;
+			float inheritanceCost = 2.0f*(combinedPerimeter - perimeter);
+
+			auto getChildCost = [&](int child)
+			{
+				const Node& childNode = mNodes[child];
+				float childCost = GetPerimeter(childNode.aabb.Expand(leafAABB)) + inheritanceCost;
+				if (!childNode.IsLeaf())
+					childCost -= GetPerimeter(childNode.aabb);
+
+				return childCost;
+			};
+
+			float leftCost = getChildCost(node.left);
+			float rightCost = getChildCost(node.right);
+
+			if (cost < leftCost && cost < rightCost)
+				break;
+
+			sibling = leftCost < rightCost ? node.left : node.right;
+		}
+
+		int oldParent = mNodes[sibling].parent;
+		int newParent = AllocateNode();
+
+		mNodes[newParent].parent = oldParent;
+		mNodes[newParent].aabb = mNodes[sibling].aabb.Expand(leafAABB);
+		mNodes[newParent].height = mNodes[sibling].height + 1;
+		mNodes[newParent].left = sibling;
+		mNodes[newParent].right = leaf;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		if (oldParent < 0)
+			mRoot = newParent;
+		else
+		{
+			if (mNodes[oldParent].left == sibling)
+				mNodes[oldParent].left = newParent;
+			else
+				mNodes[oldParent].right = newParent;
+		}
+
+		FixUpwards(mNodes[leaf].parent);
+	}
+
+	void AABBTree::RemoveLeaf(int leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = -1;
+			return;
+		}
+
+		int parent = mNodes[leaf].parent;
+		int grandParent = mNodes[parent].parent;
+		int sibling = mNodes[parent].left == leaf ? mNodes[parent].right : mNodes[parent].left;
+
+		FreeNode(parent);
+
+		if (grandParent < 0)
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = -1;
+			return;
+		}
+
+		if (mNodes[grandParent].left == parent)
+			mNodes[grandParent].left = sibling;
+		else
+			mNodes[grandParent].right = sibling;
+
+		mNodes[sibling].parent = grandParent;
+
+		FixUpwards(grandParent);
+	}
+
+	void AABBTree::FixUpwards(int node)
+	{
+		while (node >= 0)
+		{
+			node = Balance(node);
+
+			Node& current = mNodes[node];
+			current.height = 1 + Math::Max(mNodes[current.left].height, mNodes[current.right].height);
+			current.aabb = mNodes[current.left].aabb.Expand(mNodes[current.right].aabb);
+
+			node = current.parent;
+		}
+	}
+
+	int AABBTree::Balance(int a)
+	{
+		if (mNodes[a].IsLeaf() || mNodes[a].height < 2)
+			return a;
+
+		int b = mNodes[a].left;
+		int c = mNodes[a].right;
+
+		int balance = mNodes[c].height - mNodes[b].height;
+		if (balance >= -1 && balance <= 1)
+			return a;
+
+		// Higher child is rotated up, its higher child stays under it, lower child goes to a
+		int up = balance > 1 ? c : b;
+		int down = balance > 1 ? b : c;
+
+		int f = mNodes[up].left;
+		int g = mNodes[up].right;
+
+		mNodes[up].left = a;
+		mNodes[up].parent = mNodes[a].parent;
+		mNodes[a].parent = up;
+
+		if (mNodes[up].parent < 0)
+			mRoot = up;
+		else
+		{
+			Node& upParent = mNodes[mNodes[up].parent];
+			if (upParent.left == a)
+				upParent.left = up;
+			else
+				upParent.right = up;
+		}
+
+		int higher = mNodes[f].height > mNodes[g].height ? f : g;
+		int lower = higher == f ? g : f;
+
+		mNodes[up].right = higher;
+
+		if (balance > 1)
+		{
+			mNodes[a].left = down;
+			mNodes[a].right = lower;
+		}
+		else
+		{
+			mNodes[a].left = lower;
+			mNodes[a].right = down;
+		}
+
+		mNodes[lower].parent = a;
+
+		mNodes[a].aabb = mNodes[mNodes[a].left].aabb.Expand(mNodes[mNodes[a].right].aabb);
+		mNodes[a].height = 1 + Math::Max(mNodes[mNodes[a].left].height, mNodes[mNodes[a].right].height);
+
+		mNodes[up].aabb = mNodes[a].aabb.Expand(mNodes[higher].aabb);
+		mNodes[up].height = 1 + Math::Max(mNodes[a].height, mNodes[higher].height);
+
+		return up;
+	}
+
+	RectF AABBTree::Fatten(const RectF& aabb) const
+	{
+		Vec2F extend = Vec2F(Math::Abs(aabb.right - aabb.left), Math::Abs(aabb.top - aabb.bottom))*0.1f + Vec2F(mMargin, mMargin);
+		return RectF(aabb.left - extend.x, aabb.top + extend.y, aabb.right + extend.x, aabb.bottom - extend.y);
+	}
+
+	float AABBTree::GetPerimeter(const RectF& rect)
+	{
+		return 2.0f*((rect.right - rect.left) + (rect.top - rect.bottom));
+	}
+
+	bool AABBTree::IsContains(const RectF& outer, const RectF& inner)
+	{
+		return outer.left <= inner.left && outer.right >= inner.right && outer.bottom <= inner.bottom && outer.top >= inner.top;
+	}
+}
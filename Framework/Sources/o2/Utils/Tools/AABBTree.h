@@ -0,0 +1,137 @@
+#pragma once
+
+#include "o2/Utils/Debug/Assert.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------------------
+	// Dynamic axis aligned bounding boxes tree. Each proxy is stored in leaf with fattened rectangle, so small
+	// movements don't change tree. Tree is kept balanced by rotations, so querying is logarithmic by proxies count
+	// ---------------------------------------------------------------------------------------------------------
+	class AABBTree
+	{
+	public:
+		// Constructor. Margin is added to proxies rectangles in addition to part of their sizes
+		AABBTree(float margin = 1.0f);
+
+		// Adds proxy with rectangle and user data, returns proxy id
+		int Add(const RectF& aabb, void* userData);
+
+		// Removes proxy
+		void Remove(int proxy);
+
+		// Updates proxy rectangle. Returns true when proxy was reinserted, false when rectangle is inside fattened rectangle
+		bool Move(int proxy, const RectF& aabb);
+
+		// Returns proxy user data
+		void* GetUserData(int proxy) const;
+
+		// Returns proxy fattened rectangle
+		const RectF& GetFatAABB(int proxy) const;
+
+		// Returns count of proxies
+		int GetProxiesCount() const;
+
+		// Returns tree height, 0 for empty tree
+		int GetHeight() const;
+
+		// Removes all proxies
+		void Clear();
+
+		// Calls callback(void* userData) for each proxy, which fattened rectangle intersects rect
+		template<typename _callback>
+		void Query(const RectF& rect, _callback callback) const;
+
+		// Calls callback(void* userData) for each proxy, which fattened rectangle contains point
+		template<typename _callback>
+		void Query(const Vec2F& point, _callback callback) const;
+
+	protected:
+		static constexpr int maxStackSize = 256; // Maximum query stack size, balanced tree is much lower
+
+		struct Node
+		{
+			RectF aabb;               // Fattened rectangle for leaves, union of children rectangles for branches
+			void* userData = nullptr; // Proxy user data
+			int   parent = -1;        // Parent node index, next free node index for free nodes
+			int   left = -1;          // Left child index, -1 for leaves
+			int   right = -1;         // Right child index, -1 for leaves
+			int   height = -1;        // Node height, 0 for leaves, -1 for free nodes
+
+			// Returns true when node is leaf
+			bool IsLeaf() const { return left < 0; }
+		};
+
+	protected:
+		Vector<Node> mNodes;            // Nodes pool
+		int          mRoot = -1;        // Root node index
+		int          mFreeNodes = -1;   // First free node index
+		int          mProxiesCount = 0; // Count of proxies
+		float        mMargin = 1.0f;    // Fattening margin
+
+	protected:
+		// Takes free node or creates new one
+		int AllocateNode();
+
+		// Returns node to free list
+		void FreeNode(int node);
+
+		// Inserts leaf into tree by minimal perimeter cost
+		void InsertLeaf(int leaf);
+
+		// Removes leaf from tree
+		void RemoveLeaf(int leaf);
+
+		// Balances subtree by rotation, returns new subtree root
+		int Balance(int node);
+
+		// Recalculates branches rectangles and heights from node to root, balancing them
+		void FixUpwards(int node);
+
+		// Returns fattened rectangle
+		RectF Fatten(const RectF& aabb) const;
+
+		// Returns rectangle perimeter, used as insertion cost
+		static float GetPerimeter(const RectF& rect);
+
+		// Returns true when outer rectangle contains inner rectangle
+		static bool IsContains(const RectF& outer, const RectF& inner);
+	};
+
+	template<typename _callback>
+	void AABBTree::Query(const RectF& rect, _callback callback) const
+	{
+		if (mRoot < 0)
+			return;
+
+		int stack[maxStackSize];
+		int stackSize = 0;
+		stack[stackSize++] = mRoot;
+
+		while (stackSize > 0)
+		{
+			const Node& node = mNodes[stack[--stackSize]];
+			if (!node.aabb.IsIntersects(rect))
+				continue;
+
+			if (node.IsLeaf())
+				callback(node.userData);
+			else
+			{
+				Assert(stackSize + 2 <= maxStackSize, "AABB tree is too high");
+
+				stack[stackSize++] = node.left;
+				stack[stackSize++] = node.right;
+			}
+		}
+	}
+
+	template<typename _callback>
+	void AABBTree::Query(const Vec2F& point, _callback callback) const
+	{
+		Query(RectF(point.x, point.y, point.x, point.y), callback);
+	}
+}
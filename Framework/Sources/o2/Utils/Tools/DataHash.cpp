@@ -0,0 +1,116 @@
+#include "o2/stdafx.h"
+#include "DataHash.h"
+
+namespace o2
+{
+	static constexpr UInt64 hashPrime1 = 11400714785074694791ULL;
+	static constexpr UInt64 hashPrime2 = 14029467366897019727ULL;
+	static constexpr UInt64 hashPrime3 = 1609587929392839161ULL;
+	static constexpr UInt64 hashPrime4 = 9650029242287828579ULL;
+	static constexpr UInt64 hashPrime5 = 2870177450012600261ULL;
+
+	static inline UInt64 RotateLeft(UInt64 value, int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	static inline UInt64 Read64(const UInt8* data)
+	{
+		UInt64 value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline UInt Read32(const UInt8* data)
+	{
+		UInt value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline UInt64 HashRound(UInt64 accumulator, UInt64 input)
+	{
+		accumulator += input*hashPrime2;
+		accumulator = RotateLeft(accumulator, 31);
+		return accumulator*hashPrime1;
+	}
+
+	static inline UInt64 MergeRound(UInt64 accumulator, UInt64 value)
+	{
+		accumulator ^= HashRound(0, value);
+		return accumulator*hashPrime1 + hashPrime4;
+	}
+
+	UInt64 GetDataHash(const void* data, UInt64 size, UInt64 seed /*= 0*/)
+	{
+		const UInt8* current = (const UInt8*)data;
+		const UInt8* end = current + size;
+		UInt64 hash;
+
+		if (size >= 32)
+		{
+			UInt64 v1 = seed + hashPrime1 + hashPrime2;
+			UInt64 v2 = seed + hashPrime2;
+			UInt64 v3 = seed;
+			UInt64 v4 = seed - hashPrime1;
+
+			const UInt8* limit = end - 32;
+			do
+			{
+				v1 = HashRound(v1, Read64(current)); current += 8;
+				v2 = HashRound(v2, Read64(current)); current += 8;
+				v3 = HashRound(v3, Read64(current)); current += 8;
+				v4 = HashRound(v4, Read64(current)); current += 8;
+			} while (current <= limit);
+
+			hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+			hash = MergeRound(hash, v1);
+			hash = MergeRound(hash, v2);
+			hash = MergeRound(hash, v3);
+			hash = MergeRound(hash, v4);
+		}
+		else
+			hash = seed + hashPrime5;
+
+		hash += size;
+
+		while (current + 8 <= end)
+		{
+			hash ^= HashRound(0, Read64(current));
+			hash = RotateLeft(hash, 27)*hashPrime1 + hashPrime4;
+			current += 8;
+		}
+
+		if (current + 4 <= end)
+		{
+			hash ^= (UInt64)Read32(current)*hashPrime1;
+			hash = RotateLeft(hash, 23)*hashPrime2 + hashPrime3;
+			current += 4;
+		}
+
+		while (current < end)
+		{
+			hash ^= (*current)*hashPrime5;
+			hash = RotateLeft(hash, 11)*hashPrime1;
+			current++;
+		}
+
+		hash ^= hash >> 33;
+		hash *= hashPrime2;
+		hash ^= hash >> 29;
+		hash *= hashPrime3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+
+	UInt64 GetDataHash(const char* str, UInt64 seed /*= 0*/)
+	{
+		return GetDataHash(str, strlen(str), seed);
+	}
+
+	UInt64 CombineHash(UInt64 a, UInt64 b)
+	{
+		return MergeRound(a, b);
+	}
+}
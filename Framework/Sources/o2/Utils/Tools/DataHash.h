@@ -0,0 +1,15 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// Returns 64 bit hash of data, uses xxHash64 algorithm. Fast enough to hash files content for changes detection
+	UInt64 GetDataHash(const void* data, UInt64 size, UInt64 seed = 0);
+
+	// Returns 64 bit hash of string
+	UInt64 GetDataHash(const char* str, UInt64 seed = 0);
+
+	// Combines two hashes into one
+	UInt64 CombineHash(UInt64 a, UInt64 b);
+}
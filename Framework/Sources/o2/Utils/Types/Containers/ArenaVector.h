@@ -0,0 +1,191 @@
+#pragma once
+
+#include "o2/Utils/Memory/Allocators/IAllocator.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <vector>
+
+namespace o2
+{
+	// ---------------------------------------------------------------------
+	// Standard library compatible allocator, which takes memory from IAllocator
+	// ---------------------------------------------------------------------
+	template<typename _type>
+	class ArenaStdAllocator
+	{
+	public:
+		typedef _type value_type;
+
+		IAllocator* allocator; // Memory source
+
+	public:
+		// Constructor from allocator
+		ArenaStdAllocator(IAllocator* allocator);
+
+		// Copy-constructor from allocator of other type
+		template<typename _other_type>
+		ArenaStdAllocator(const ArenaStdAllocator<_other_type>& other);
+
+		// Allocates memory for count elements
+		_type* allocate(size_t count);
+
+		// Releases memory
+		void deallocate(_type* ptr, size_t count);
+
+		// Equal operator
+		template<typename _other_type>
+		bool operator==(const ArenaStdAllocator<_other_type>& other) const;
+
+		// Not equal operator
+		template<typename _other_type>
+		bool operator!=(const ArenaStdAllocator<_other_type>& other) const;
+	};
+
+	// ----------------------------------------------------------------------------------------------
+	// Dynamic linear array, which takes memory from specified allocator. Used for temporary per-frame
+	// lists and copies with frame allocator. Must not live longer than allocator's memory
+	// ----------------------------------------------------------------------------------------------
+	template<typename _type>
+	class ArenaVector: public std::vector<_type, ArenaStdAllocator<_type>>
+	{
+	public:
+		typedef std::vector<_type, ArenaStdAllocator<_type>> Base;
+
+	public:
+		// Constructor with allocator
+		ArenaVector(IAllocator& allocator);
+
+		// Constructor with allocator, copies elements from other array
+		ArenaVector(IAllocator& allocator, const Vector<_type>& arr);
+
+		// Returns data pointer
+		_type* Data();
+
+		// Returns count of elements in vector
+		int Count() const;
+
+		// Returns true if array is empty
+		bool IsEmpty() const;
+
+		// Changes capacity of vector. New capacity can't be less than current
+		void Reserve(int newCapacity);
+
+		// Adds new element
+		_type& Add(const _type& value);
+
+		// Adds elements from other array
+		void Add(const Vector<_type>& arr);
+
+		// Returns true, if array contains the element
+		bool Contains(const _type& value) const;
+
+		// Removes equal array element
+		void Remove(const _type& value);
+
+		// Removes all elements
+		void Clear();
+	};
+
+	template<typename _type>
+	ArenaStdAllocator<_type>::ArenaStdAllocator(IAllocator* allocator):
+		allocator(allocator)
+	{}
+
+	template<typename _type>
+	template<typename _other_type>
+	ArenaStdAllocator<_type>::ArenaStdAllocator(const ArenaStdAllocator<_other_type>& other):
+		allocator(other.allocator)
+	{}
+
+	template<typename _type>
+	_type* ArenaStdAllocator<_type>::allocate(size_t count)
+	{
+		return (_type*)allocator->Allocate(sizeof(_type)*count);
+	}
+
+	template<typename _type>
+	void ArenaStdAllocator<_type>::deallocate(_type* ptr, size_t count)
+	{
+		allocator->Deallocate(ptr);
+	}
+
+	template<typename _type>
+	template<typename _other_type>
+	bool ArenaStdAllocator<_type>::operator==(const ArenaStdAllocator<_other_type>& other) const
+	{
+		return allocator == other.allocator;
+	}
+
+	template<typename _type>
+	template<typename _other_type>
+	bool ArenaStdAllocator<_type>::operator!=(const ArenaStdAllocator<_other_type>& other) const
+	{
+		return allocator != other.allocator;
+	}
+
+	template<typename _type>
+	ArenaVector<_type>::ArenaVector(IAllocator& allocator):
+		Base(ArenaStdAllocator<_type>(&allocator))
+	{}
+
+	template<typename _type>
+	ArenaVector<_type>::ArenaVector(IAllocator& allocator, const Vector<_type>& arr):
+		Base(arr.begin(), arr.end(), ArenaStdAllocator<_type>(&allocator))
+	{}
+
+	template<typename _type>
+	_type* ArenaVector<_type>::Data()
+	{
+		return Base::data();
+	}
+
+	template<typename _type>
+	int ArenaVector<_type>::Count() const
+	{
+		return (int)Base::size();
+	}
+
+	template<typename _type>
+	bool ArenaVector<_type>::IsEmpty() const
+	{
+		return Base::empty();
+	}
+
+	template<typename _type>
+	void ArenaVector<_type>::Reserve(int newCapacity)
+	{
+		Base::reserve(newCapacity);
+	}
+
+	template<typename _type>
+	_type& ArenaVector<_type>::Add(const _type& value)
+	{
+		Base::push_back(value);
+		return Base::back();
+	}
+
+	template<typename _type>
+	void ArenaVector<_type>::Add(const Vector<_type>& arr)
+	{
+		Base::insert(Base::end(), arr.begin(), arr.end());
+	}
+
+	template<typename _type>
+	bool ArenaVector<_type>::Contains(const _type& value) const
+	{
+		return std::find(Base::begin(), Base::end(), value) != Base::end();
+	}
+
+	template<typename _type>
+	void ArenaVector<_type>::Remove(const _type& value)
+	{
+		auto fnd = std::find(Base::begin(), Base::end(), value);
+		if (fnd != Base::end())
+			Base::erase(fnd);
+	}
+
+	template<typename _type>
+	void ArenaVector<_type>::Clear()
+	{
+		Base::clear();
+	}
+}
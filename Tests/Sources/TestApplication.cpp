@@ -1,9 +1,19 @@
 #include "TestApplication.h"
 
+#include "Tests/AABBTree.h"
+#include "Tests/BinaryDataDocument.h"
+#include "Tests/CursorHitGrid.h"
+#include "Tests/JobSystem.h"
+#include "Tests/PhysicsInterpolation.h"
 #include "Tests/Prototypes.h"
 
 void TestApplication::OnStarted()
 {
 	Editor::EditorApplication::OnStarted();
 	TestPrototypes();
+	TestPhysicsInterpolation();
+	TestAABBTree();
+	TestBinaryDataDocument();
+	TestJobSystem();
+	TestCursorHitGrid();
 }
\ No newline at end of file
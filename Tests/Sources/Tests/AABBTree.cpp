@@ -0,0 +1,178 @@
+#include "AABBTree.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Tools/AABBTree.h"
+
+using namespace o2;
+
+// Simple deterministic random generator, so failures are reproducible
+struct TreeTestRandom
+{
+	UInt state = 12345;
+
+	// Returns random value in range [min, max]
+	float Next(float min, float max)
+	{
+		state = state*1664525u + 1013904223u;
+		return min + (max - min)*(float)(state >> 8)/(float)(1 << 24);
+	}
+};
+
+// Returns random rectangle with position in range [-range, range] and size up to maxSize
+RectF GetRandomTreeRect(TreeTestRandom& random, float range, float maxSize)
+{
+	Vec2F position(random.Next(-range, range), random.Next(-range, range));
+	Vec2F size(random.Next(0.1f, maxSize), random.Next(0.1f, maxSize));
+	return RectF(position, position + size);
+}
+
+// Checks that tree query returns same proxies as brute force check of fattened rectangles
+bool CheckTreeQuery(const AABBTree& tree, const Vector<int>& proxies, const Vector<int>& alive, const RectF& rect)
+{
+	Vector<int> found;
+	found.Resize(proxies.Count());
+	bool ok = true;
+
+	tree.Query(rect, [&](void* userData) {
+		int idx = (int)(intptr_t)userData;
+		if (idx < 0 || idx >= proxies.Count() || !alive[idx] || found[idx])
+			ok = false;
+		else
+			found[idx] = 1;
+	});
+
+	for (int i = 0; i < proxies.Count(); i++)
+	{
+		if (alive[i] && (found[i] != 0) != tree.GetFatAABB(proxies[i]).IsIntersects(rect))
+			ok = false;
+	}
+
+	return ok;
+}
+
+// Checks that tree height is logarithmic by proxies count
+bool CheckTreeBalance(const AABBTree& tree)
+{
+	int count = tree.GetProxiesCount();
+	int log2 = 0;
+	while ((1 << log2) < count)
+		log2++;
+
+	return tree.GetHeight() <= 2*log2 + 1;
+}
+
+// This is the test of AABB tree
+// Here we adding random and sorted proxies, querying them and comparing with brute force results,
+// moving proxies slightly and far, removing part of them and checking that tree stays balanced
+void TestAABBTree()
+{
+	const int proxiesCount = 1000;
+	const int queriesCount = 200;
+
+	TreeTestRandom random;
+	AABBTree tree;
+
+	Vector<int> proxies;
+	Vector<int> alive;
+	Vector<RectF> rects;
+	int failsCount = 0;
+
+	auto check = [&](bool result, const String& name) {
+		if (!result)
+		{
+			o2Debug.LogError("AABB tree " + name + " - FAILED");
+			failsCount++;
+		}
+	};
+
+	// Insert: random rectangles
+	for (int i = 0; i < proxiesCount; i++)
+	{
+		RectF rect = GetRandomTreeRect(random, 1000.0f, 50.0f);
+		rects.Add(rect);
+		proxies.Add(tree.Add(rect, (void*)(intptr_t)i));
+		alive.Add(1);
+	}
+
+	check(tree.GetProxiesCount() == proxiesCount, "proxies count after insert");
+	check(CheckTreeBalance(tree), "balance after random insert");
+
+	bool insertedContained = true;
+	for (int i = 0; i < proxiesCount; i++)
+	{
+		const RectF& fat = tree.GetFatAABB(proxies[i]);
+		insertedContained &= fat.left <= rects[i].left && fat.right >= rects[i].right &&
+			fat.bottom <= rects[i].bottom && fat.top >= rects[i].top && tree.GetUserData(proxies[i]) == (void*)(intptr_t)i;
+	}
+	check(insertedContained, "fattened rectangles and user data");
+
+	// Query: random rectangles and points
+	bool queriesOk = true;
+	for (int i = 0; i < queriesCount; i++)
+	{
+		queriesOk &= CheckTreeQuery(tree, proxies, alive, GetRandomTreeRect(random, 1100.0f, 300.0f));
+
+		Vec2F point(random.Next(-1000.0f, 1000.0f), random.Next(-1000.0f, 1000.0f));
+		queriesOk &= CheckTreeQuery(tree, proxies, alive, RectF(point.x, point.y, point.x, point.y));
+	}
+	check(queriesOk, "query after insert");
+
+	// Move: small movements stay inside fattened rectangles, far movements reinsert proxies
+	bool smallMovesOk = true;
+	for (int i = 0; i < proxiesCount; i += 2)
+	{
+		RectF fat = tree.GetFatAABB(proxies[i]);
+		RectF moved = rects[i] + Vec2F(0.5f, -0.5f);
+
+		smallMovesOk &= !tree.Move(proxies[i], moved) && tree.GetFatAABB(proxies[i]) == fat;
+	}
+	check(smallMovesOk, "small move");
+
+	bool farMovesOk = true;
+	for (int i = 1; i < proxiesCount; i += 2)
+	{
+		rects[i] = GetRandomTreeRect(random, 1000.0f, 50.0f) + Vec2F(3000.0f, 0.0f);
+		farMovesOk &= tree.Move(proxies[i], rects[i]);
+
+		Vec2F center = rects[i].Center();
+		bool found = false;
+		tree.Query(center, [&](void* userData) { found |= userData == (void*)(intptr_t)i; });
+		farMovesOk &= found;
+	}
+	check(farMovesOk, "far move");
+	check(tree.GetProxiesCount() == proxiesCount, "proxies count after move");
+	check(CheckTreeBalance(tree), "balance after move");
+
+	queriesOk = true;
+	for (int i = 0; i < queriesCount; i++)
+		queriesOk &= CheckTreeQuery(tree, proxies, alive, GetRandomTreeRect(random, 4000.0f, 1000.0f));
+	check(queriesOk, "query after move");
+
+	// Remove: every third proxy
+	int aliveCount = proxiesCount;
+	for (int i = 0; i < proxiesCount; i += 3)
+	{
+		tree.Remove(proxies[i]);
+		alive[i] = 0;
+		aliveCount--;
+	}
+
+	check(tree.GetProxiesCount() == aliveCount, "proxies count after remove");
+	check(CheckTreeBalance(tree), "balance after remove");
+
+	queriesOk = true;
+	for (int i = 0; i < queriesCount; i++)
+		queriesOk &= CheckTreeQuery(tree, proxies, alive, GetRandomTreeRect(random, 4000.0f, 1000.0f));
+	check(queriesOk, "query after remove");
+
+	// Balance: sorted insertion is the worst case for not balanced tree
+	tree.Clear();
+	check(tree.GetProxiesCount() == 0 && tree.GetHeight() == 0, "clear");
+
+	for (int i = 0; i < proxiesCount; i++)
+		tree.Add(RectF(i*10.0f, 1.0f, i*10.0f + 1.0f, 0.0f), (void*)(intptr_t)i);
+
+	check(CheckTreeBalance(tree), "balance after sorted insert");
+
+	o2Debug.Log("AABB tree - " + String(failsCount > 0 ? "failed" : "OK"));
+}
@@ -0,0 +1,84 @@
+#include "BinaryDataDocument.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+using namespace o2;
+
+// This is the test of binary data document format
+// Here we loading JSON document with all values types, writing it in binary format and parsing back,
+// in memory and through file with format detection. Then checking that documents are same, JSON texts
+// are same and binary data written again from loaded document is same
+void TestBinaryDataDocument()
+{
+	const String source =
+		"{"
+		"\"null\": null, \"true\": true, \"false\": false,"
+		"\"int\": -12345, \"uint\": 3000000000, \"int64\": -9000000000000, \"uint64\": 18000000000000000000,"
+		"\"double\": 0.1, \"negativeDouble\": -1.5e-300,"
+		"\"string\": \"value\", \"emptyString\": \"\", \"escapedString\": \"quote \\\" slash \\\\ line\\n\","
+		"\"sameString\": \"value\", \"value\": \"member name is same as string\","
+		"\"emptyObject\": {}, \"emptyArray\": [],"
+		"\"array\": [1, -1, 2.5, \"value\", null, [true, false], {\"int\": 7}],"
+		"\"object\": {\"nested\": {\"deeper\": {\"array\": [[], [[]], {}]}}, \"int\": 0}"
+		"}";
+
+	const String fileName = "BinaryDataDocumentTest.bin";
+
+	int failsCount = 0;
+	auto check = [&](bool result, const String& name) {
+		if (!result)
+		{
+			o2Debug.LogError("Binary data document " + name + " - FAILED");
+			failsCount++;
+		}
+	};
+
+	DataDocument jsonDocument;
+	check(jsonDocument.LoadFromData(source), "source parsing");
+
+	String jsonText = jsonDocument.SaveAsString();
+
+	// In memory round trip
+	Vector<char> binaryData;
+	WriteBinary(binaryData, jsonDocument);
+	check(IsBinaryData(binaryData.Data(), binaryData.Count()), "signature");
+
+	Vector<char> parsingData = binaryData;
+	DataDocument binaryDocument;
+	check(ParseBinaryInplace(parsingData.Data(), parsingData.Count(), binaryDocument), "parsing");
+	check(binaryDocument == jsonDocument, "values after parsing");
+	check(binaryDocument.SaveAsString() == jsonText, "JSON text after parsing");
+
+	Vector<char> rewrittenData;
+	WriteBinary(rewrittenData, binaryDocument);
+	check(rewrittenData == binaryData, "writing parsed document");
+
+	// Truncated data must be rejected, not read out of buffer
+	bool truncatedRejected = true;
+	for (int size = 0; size < binaryData.Count(); size += 7)
+	{
+		Vector<char> truncatedData(binaryData);
+		truncatedData.Resize(size);
+
+		DataDocument truncatedDocument;
+		truncatedRejected &= !ParseBinaryInplace(truncatedData.Data(), size, truncatedDocument);
+	}
+	check(truncatedRejected, "truncated data");
+
+	// File round trip, format is detected by signature
+	check(jsonDocument.SaveToFile(fileName, DataDocument::Format::Binary), "saving to file");
+
+	DataDocument fileDocument;
+	check(fileDocument.LoadFromFile(fileName), "loading from file");
+	check(fileDocument == jsonDocument, "values after loading from file");
+	check(fileDocument.SaveAsString() == jsonText, "JSON text after loading from file");
+
+	// Releasing mapped file before deleting it
+	fileDocument = DataDocument();
+	o2FileSystem.FileDelete(fileName);
+
+	o2Debug.Log("Binary data document - " + String(failsCount > 0 ? "failed" : "OK"));
+}
@@ -0,0 +1,151 @@
+#include "CursorHitGrid.h"
+
+#include "o2/Events/CursorAreaEventsListenersLayer.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// Cursor area listener with fixed bounds
+class HitGridTestListener: public CursorAreaEventsListener
+{
+public:
+	RectF bounds; // Cursor area bounds
+
+public:
+	// Constructor
+	HitGridTestListener(const RectF& bounds):
+		bounds(bounds)
+	{}
+
+	// Returns fixed bounds
+	RectF GetCursorAreaBounds() override { return bounds; }
+};
+
+// Simple deterministic random generator, so failures are reproducible
+struct HitGridTestRandom
+{
+	UInt state = 54321;
+
+	// Returns random value in range [min, max]
+	float Next(float min, float max)
+	{
+		state = state*1664525u + 1013904223u;
+		return min + (max - min)*(float)(state >> 8)/(float)(1 << 24);
+	}
+};
+
+// Checks that layer returns listeners at point in same order as brute force check of listeners bounds
+bool CheckHitGridQueries(const CursorAreaEventListenersLayer& layer, HitGridTestRandom& random, int queriesCount)
+{
+	for (int i = 0; i < queriesCount; i++)
+	{
+		Vec2F point(random.Next(-1100.0f, 1100.0f), random.Next(-1100.0f, 1100.0f));
+
+		Vector<CursorAreaEventsListener*> expected;
+		for (auto listener : layer.cursorEventAreaListeners)
+		{
+			RectF bounds = listener->GetCursorAreaBounds();
+			if (point.x >= bounds.left && point.x <= bounds.right && point.y >= bounds.bottom && point.y <= bounds.top)
+				expected.Add(listener);
+		}
+
+		if (layer.GetListenersAtPoint(point) != expected)
+			return false;
+	}
+
+	return true;
+}
+
+// This is the test of cursor listeners hit testing grid
+// Here we adding small, medium, wide and unbounded listeners in drawing order, querying listeners at random points
+// and comparing them with brute force results in same order. Then removing part of listeners and adding new ones,
+// and checking degenerate cases, when all listeners are same and when there are no bounded listeners
+void TestCursorHitGrid()
+{
+	const int queriesCount = 500;
+
+	HitGridTestRandom random;
+	int failsCount = 0;
+
+	auto check = [&](bool result, const String& name) {
+		if (!result)
+		{
+			o2Debug.LogError("Cursor hit grid " + name + " - FAILED");
+			failsCount++;
+		}
+	};
+
+	Vector<HitGridTestListener*> listeners;
+	auto createListener = [&](const RectF& bounds) {
+		HitGridTestListener* listener = mnew HitGridTestListener(bounds);
+		listeners.Add(listener);
+		return listener;
+	};
+
+	auto getRandomRect = [&](float range, float maxSize) {
+		Vec2F position(random.Next(-range, range), random.Next(-range, range));
+		Vec2F size(random.Next(1.0f, maxSize), random.Next(1.0f, maxSize));
+		return RectF(position, position + size);
+	};
+
+	{
+		CursorAreaEventListenersLayer layer;
+
+		// Mixed listeners: wide and unbounded ones are between bounded, so merging must keep order
+		for (int i = 0; i < 400; i++)
+		{
+			if (i%100 == 50)
+				layer.AddDrawnListener(createListener(RectF(-1000.0f, 1000.0f, 1000.0f, -1000.0f)));
+			else if (i%100 == 99)
+				layer.AddDrawnListener(createListener(RectF(-1e7f, 1e7f, 1e7f, -1e7f)));
+			else if (i%10 == 0)
+				layer.AddDrawnListener(createListener(getRandomRect(1000.0f, 400.0f)));
+			else
+				layer.AddDrawnListener(createListener(getRandomRect(1000.0f, 40.0f)));
+		}
+
+		check(CheckHitGridQueries(layer, random, queriesCount), "mixed listeners order");
+
+		// Removing listeners rebuilds grid
+		for (int i = 0; i < listeners.Count(); i += 3)
+			layer.UnregCursorAreaListener(listeners[i]);
+
+		check(CheckHitGridQueries(layer, random, queriesCount), "order after removing");
+
+		// Next listeners are added on top
+		for (int i = 0; i < 100; i++)
+			layer.AddDrawnListener(createListener(getRandomRect(1000.0f, 100.0f)));
+
+		check(CheckHitGridQueries(layer, random, queriesCount), "order after adding");
+	}
+
+	{
+		CursorAreaEventListenersLayer layer;
+
+		// Same listeners: each cell contains all of them
+		for (int i = 0; i < 50; i++)
+			layer.AddDrawnListener(createListener(RectF(-100.0f, 100.0f, 100.0f, -100.0f)));
+
+		check(CheckHitGridQueries(layer, random, queriesCount), "same listeners order");
+	}
+
+	{
+		CursorAreaEventListenersLayer layer;
+
+		// Only unbounded listeners: there is no grid, all listeners are checked as wide
+		for (int i = 0; i < 10; i++)
+			layer.AddDrawnListener(createListener(RectF(-1e7f, 1e7f, 1e7f, -1e7f)));
+
+		check(CheckHitGridQueries(layer, random, queriesCount), "unbounded listeners order");
+	}
+
+	{
+		CursorAreaEventListenersLayer layer;
+		check(layer.GetListenersAtPoint(Vec2F()).IsEmpty(), "empty layer");
+	}
+
+	for (auto listener : listeners)
+		delete listener;
+
+	o2Debug.Log("Cursor hit grid - " + String(failsCount > 0 ? "failed" : "OK"));
+}
@@ -0,0 +1,86 @@
+#include "JobSystem.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Tasks/JobSystem.h"
+
+using namespace o2;
+
+// Runs parallel for with batch size and checks that each index is visited exactly once
+bool CheckParallelForVisits(int count, int batchSize)
+{
+	std::atomic<int>* visits = mnew std::atomic<int>[count + 1];
+	for (int i = 0; i < count + 1; i++)
+		visits[i] = 0;
+
+	o2Jobs.ParallelFor(count, [&](int idx) {
+		if (idx >= 0 && idx < count)
+			visits[idx]++;
+		else
+			visits[count]++;
+	}, batchSize);
+
+	bool ok = visits[count] == 0;
+	for (int i = 0; i < count; i++)
+		ok &= visits[i] == 1;
+
+	delete[] visits;
+	return ok;
+}
+
+// This is the test of job system parallel for
+// Here we running parallel for with different counts and batch sizes and checking that each index is visited
+// exactly once, then running parallel for inside parallel for jobs and jobs, started with counter
+void TestJobSystem()
+{
+	int failsCount = 0;
+	auto check = [&](bool result, const String& name) {
+		if (!result)
+		{
+			o2Debug.LogError("Job system " + name + " - FAILED");
+			failsCount++;
+		}
+	};
+
+	// Visits: empty range, single index, batch size larger than count and not multiple of count
+	check(CheckParallelForVisits(0, 1), "parallel for empty range");
+	check(CheckParallelForVisits(1, 1), "parallel for single index");
+	check(CheckParallelForVisits(1000, 1), "parallel for batch size 1");
+	check(CheckParallelForVisits(1000, 3), "parallel for batch size 3");
+	check(CheckParallelForVisits(1000, 64), "parallel for batch size 64");
+	check(CheckParallelForVisits(1000, 1000), "parallel for single batch");
+	check(CheckParallelForVisits(1000, 5000), "parallel for batch larger than count");
+	check(CheckParallelForVisits(1000, 0), "parallel for zero batch size");
+
+	// Nested: waiting jobs execute other jobs, so inner parallel for doesn't deadlock
+	const int outerCount = 16;
+	const int innerCount = 64;
+
+	std::atomic<int> nestedVisits[outerCount*innerCount];
+	for (auto& visits : nestedVisits)
+		visits = 0;
+
+	o2Jobs.ParallelFor(outerCount, [&](int i) {
+		o2Jobs.ParallelFor(innerCount, [&](int j) { nestedVisits[i*innerCount + j]++; }, 4);
+	});
+
+	bool nestedOk = true;
+	for (auto& visits : nestedVisits)
+		nestedOk &= visits == 1;
+
+	check(nestedOk, "nested parallel for");
+
+	// Jobs with counter: wait returns when all jobs are done
+	const int jobsCount = 100;
+
+	std::atomic<long long> sum { 0 };
+	JobsCounter counter;
+	for (int i = 1; i <= jobsCount; i++)
+		o2Jobs.Run([&sum, i]() { sum += i; }, counter);
+
+	o2Jobs.Wait(counter);
+
+	check(counter.IsDone() && sum == jobsCount*(jobsCount + 1)/2, "jobs with counter");
+
+	o2Debug.Log("Job system on " + (String)o2Jobs.GetThreadsCount() + " threads - " +
+				String(failsCount > 0 ? "failed" : "OK"));
+}
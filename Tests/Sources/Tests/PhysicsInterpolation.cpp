@@ -0,0 +1,92 @@
+#include "PhysicsInterpolation.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Config/ProjectConfig.h"
+#include "o2/Physics/PhysicsWorld.h"
+#include "o2/Scene/Physics/RigidBody.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Debug.h"
+
+using namespace o2;
+
+// This is the test of physics interpolation
+// Here we creating body, spinning with constant angular velocity, and running frames loop like application does,
+// with frame time less than fixed step, so some frames don't have physics steps
+// Then checking that actor rotates with same speed and doesn't freeze between steps
+void TestPhysicsInterpolation()
+{
+	const float angularVelocity = 2.0f;
+	const float fixedDT = 1.0f/60.0f;
+	const float frameDT = 1.0f/90.0f;
+	const int framesCount = 180;
+	const double fullTurn = 6.283185307179586;
+
+	auto prevGravity = o2Config.physics.gravity;
+	auto prevInterpolation = o2Config.physics.interpolation;
+
+	o2Config.physics.gravity = Vec2F();
+	o2Config.physics.interpolation = PhysicsConfig::InterpolationMode::Interpolate;
+
+	RigidBody* body = mnew RigidBody();
+	body->name = "spinning body";
+	body->inertia = 1.0f;
+
+	// Update scene to add body into physics world
+	o2Scene.Update(0.0f);
+
+	body->angularVelocity = angularVelocity;
+
+	float accumulatedDT = 0.0f;
+	float prevAngle = body->transform->GetWorldAngle();
+	double totalAngle = 0.0;
+	int frozenFrames = 0;
+
+	for (int i = 0; i < framesCount; i++)
+	{
+		o2Scene.Update(frameDT);
+
+		accumulatedDT += frameDT;
+		while (accumulatedDT > fixedDT)
+		{
+			o2Physics.PreUpdate();
+			o2Physics.Update(fixedDT);
+			o2Physics.PostUpdate();
+
+			accumulatedDT -= fixedDT;
+		}
+
+		o2Physics.Interpolate(accumulatedDT/fixedDT);
+
+		float angle = body->transform->GetWorldBasis().GetAngle();
+		double delta = std::remainder((double)angle - prevAngle, fullTurn);
+		prevAngle = angle;
+
+		// First frames are one step behind physics until body has two physics states
+		if (i < 3)
+			continue;
+
+		if (Math::Abs(delta) < 0.0001)
+			frozenFrames++;
+
+		totalAngle += delta;
+	}
+
+	double expectedAngle = angularVelocity*frameDT*(framesCount - 3);
+	double error = Math::Abs(totalAngle - expectedAngle)/expectedAngle;
+
+	if (error > 0.02)
+	{
+		o2Debug.LogError("Interpolated body rotation speed changed: expected angle " + (String)(float)expectedAngle +
+						 ", actual " + (String)(float)totalAngle);
+	}
+
+	if (frozenFrames > 0)
+		o2Debug.LogError("Interpolated body froze on " + (String)frozenFrames + " frames");
+
+	o2Debug.Log("Physics interpolation of spinning body - " + String(error > 0.02 || frozenFrames > 0 ? "failed" : "OK"));
+
+	o2Scene.DestroyActor(body);
+
+	o2Config.physics.gravity = prevGravity;
+	o2Config.physics.interpolation = prevInterpolation;
+}